@@ -111,6 +111,18 @@ Adafruit_SH1106G::Adafruit_SH1106G(uint16_t w, uint16_t h, SPIClass *spi,
 */
 Adafruit_SH1106G::~Adafruit_SH1106G(void) {}
 
+/*!
+    @brief  Program the display-start-line register. On the SH1106 the
+            line is packed into the 0x40-0x7F command byte itself rather
+            than sent as an argument.
+    @param  line
+            RAM line (0-63) to map onto the top display row.
+    @return true if the command was acknowledged.
+*/
+bool Adafruit_SH1106G::oled_setStartLine(uint8_t line) {
+  return oled_command(SH110X_SETSTARTLINE | (line & 0x3F));
+}
+
 /*!
     @brief  Allocate RAM for image buffer, initialize peripherals and pins.
     @param  addr
@@ -140,8 +152,10 @@ bool Adafruit_SH1106G::begin(uint8_t addr, bool reset) {
       2; // the SH1106 display we have found requires a small offset into memory
 
 #ifndef SH110X_NO_SPLASH
-  drawBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
-             splash2_data, splash2_width, splash2_height, 1);
+  if (!_fast_boot) {
+    drawBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
+               splash2_data, splash2_width, splash2_height, 1);
+  }
 #endif
 
   // Init sequence, make sure its under 32 bytes, or split into multiples!
@@ -170,8 +184,59 @@ bool Adafruit_SH1106G::begin(uint8_t addr, bool reset) {
     return false;
   }
 
-  delay(100);                     // 100ms delay recommended
+  _dcdc_mode = 0x8B; // init list enabled the internal pump
+  _contrast = 0xFF;  // init list's SETCONTRAST value
+  _clock_div = 0x80; // init list's SETDISPLAYCLOCKDIV value
+  _sleeping = false;
+
+  // 100ms recommended; beginFast() substitutes its caller-set minimum
+  delay(_fast_boot ? _fast_boot_delay_ms : 100);
   oled_command(SH110X_DISPLAYON); // 0xaf
 
   return true; // Success
 }
+
+/*!
+    @brief  As begin(addr, reset), minus the startup latency: the splash
+            is skipped (no compile-time SH110X_NO_SPLASH needed) and the
+            conservative 100 ms pre-DISPLAYON settle is replaced by the
+            short caller-overridable minimum from setFastBootDelay().
+            Meant for wake-show-sleep battery devices where cold boot to
+            first pixel is the budget that matters.
+    @param  addr
+            I2C address, as for begin(addr, reset).
+    @param  reset
+            Hard-reset policy, as for begin(addr, reset).
+    @return true on successful allocation/init, false otherwise.
+*/
+bool Adafruit_SH1106G::beginFast(uint8_t addr, bool reset) {
+  _fast_boot = true;
+  bool ok = begin(addr, reset);
+  _fast_boot = false;
+  return ok;
+}
+
+/*!
+    @brief  As begin(addr, reset), but adopting a caller-provided
+            framebuffer instead of heap-allocating one -- zero heap use
+            after boot, and the buffer can live in a static/DMA-capable
+            region. See Adafruit_SH110X::setBuffer().
+    @param  fb
+            Framebuffer of at least WIDTH * ((HEIGHT + 7) / 8) bytes
+            (Adafruit_SH1106G_T<W, H>::kBufferSize at compile time).
+    @param  len
+            Size of the provided buffer.
+    @param  addr
+            I2C address, as for begin(addr, reset).
+    @param  reset
+            Hard-reset policy, as for begin(addr, reset).
+    @return true on successful init, false on failure (including a
+            too-small buffer).
+*/
+bool Adafruit_SH1106G::begin(uint8_t *fb, size_t len, uint8_t addr,
+                             bool reset) {
+  if (!setBuffer(fb, len)) {
+    return false;
+  }
+  return begin(addr, reset);
+}
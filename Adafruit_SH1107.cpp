@@ -43,7 +43,9 @@
 Adafruit_SH1107::Adafruit_SH1107(uint16_t w, uint16_t h, TwoWire *twi,
                                  int16_t rst_pin, uint32_t clkDuring,
                                  uint32_t clkAfter)
-    : Adafruit_SH110X(w, h, twi, rst_pin, clkDuring, clkAfter) {}
+    : Adafruit_SH110X(w, h, twi, rst_pin, clkDuring, clkAfter) {
+  _vertical_ok = true; // SH1107 supports vertical addressing
+}
 
 /*!
     @brief  Constructor for SPI SH1107 displays, using software (bitbang)
@@ -74,7 +76,9 @@ Adafruit_SH1107::Adafruit_SH1107(uint16_t w, uint16_t h, TwoWire *twi,
 Adafruit_SH1107::Adafruit_SH1107(uint16_t w, uint16_t h, int16_t mosi_pin,
                                  int16_t sclk_pin, int16_t dc_pin,
                                  int16_t rst_pin, int16_t cs_pin)
-    : Adafruit_SH110X(w, h, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {}
+    : Adafruit_SH110X(w, h, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {
+  _vertical_ok = true;
+}
 
 /*!
     @brief  Constructor for SPI SH1107 displays, using native hardware SPI.
@@ -104,7 +108,9 @@ Adafruit_SH1107::Adafruit_SH1107(uint16_t w, uint16_t h, int16_t mosi_pin,
 Adafruit_SH1107::Adafruit_SH1107(uint16_t w, uint16_t h, SPIClass *spi,
                                  int16_t dc_pin, int16_t rst_pin,
                                  int16_t cs_pin, uint32_t bitrate)
-    : Adafruit_SH110X(w, h, spi, dc_pin, rst_pin, cs_pin, bitrate) {}
+    : Adafruit_SH110X(w, h, spi, dc_pin, rst_pin, cs_pin, bitrate) {
+  _vertical_ok = true;
+}
 
 /*!
     @brief  Destructor for Adafruit_SH1107 object.
@@ -141,13 +147,13 @@ bool Adafruit_SH1107::begin(uint8_t addr, bool reset) {
 #ifndef SH110X_NO_SPLASH
   // the featherwing with 128x64 oled is 'rotated' so to make the splash right,
   // rotate!
-  if (WIDTH == 64 && HEIGHT == 128) {
+  if (!_fast_boot && WIDTH == 64 && HEIGHT == 128) {
     setRotation(1);
     drawBitmap((HEIGHT - splash2_width) / 2, (WIDTH - splash2_height) / 2,
                splash2_data, splash2_width, splash2_height, 1);
     setRotation(0);
   }
-  if (WIDTH == 128 && HEIGHT == 128) {
+  if (!_fast_boot && WIDTH == 128 && HEIGHT == 128) {
     drawBitmap((HEIGHT - splash2_width) / 2, (WIDTH - splash2_height) / 2,
                splash2_data, splash2_width, splash2_height, 1);
   }
@@ -175,21 +181,84 @@ bool Adafruit_SH1107::begin(uint8_t addr, bool reset) {
   };
   // clang-format on
 
-  if (!oled_commandList(init, sizeof(init))) {
-    return false;
-  }
+  static const uint8_t init_128x128[] = {
+      SH110X_SETDISPLAYOFFSET, 0x00, SH110X_SETMULTIPLEX, 0x7F, // 0xa8, 0x3f,
+  };
 
-  if (WIDTH == 128 && HEIGHT == 128) {
-    static const uint8_t init_128x128[] = {
-        SH110X_SETDISPLAYOFFSET, 0x00, SH110X_SETMULTIPLEX, 0x7F, // 0xa8, 0x3f,
-    };
-    if (!oled_commandList(init_128x128, sizeof(init_128x128))) {
+  if (_fast_boot && WIDTH == 128 && HEIGHT == 128) {
+    // batch both lists into one bus transaction (still under the 32-byte
+    // transfer limit with the control byte)
+    uint8_t merged[sizeof(init) + sizeof(init_128x128)];
+    memcpy(merged, init, sizeof(init));
+    memcpy(merged + sizeof(init), init_128x128, sizeof(init_128x128));
+    if (!oled_commandList(merged, sizeof(merged))) {
       return false;
     }
+  } else {
+    if (!oled_commandList(init, sizeof(init))) {
+      return false;
+    }
+    if (WIDTH == 128 && HEIGHT == 128) {
+      if (!oled_commandList(init_128x128, sizeof(init_128x128))) {
+        return false;
+      }
+    }
   }
 
-  delay(100);                     // 100ms delay recommended
+  _dcdc_mode = 0x8A; // init list's DC-DC setting
+  _contrast = 0x4F;  // init list's SETCONTRAST value
+  _clock_div = 0x51; // init list's SETDISPLAYCLOCKDIV value
+  _sleeping = false;
+
+  // 100ms recommended; beginFast() substitutes its caller-set minimum
+  delay(_fast_boot ? _fast_boot_delay_ms : 100);
   oled_command(SH110X_DISPLAYON); // 0xaf
 
   return true; // Success
 }
+
+/*!
+    @brief  As begin(addr, reset), minus the startup latency: the splash
+            is skipped (no compile-time SH110X_NO_SPLASH needed), the two
+            128x128 init lists are batched into one bus transaction, and
+            the conservative 100 ms pre-DISPLAYON settle is replaced by
+            the short caller-overridable minimum from setFastBootDelay().
+            Meant for wake-show-sleep battery devices where cold boot to
+            first pixel is the budget that matters.
+    @param  addr
+            I2C address, as for begin(addr, reset).
+    @param  reset
+            Hard-reset policy, as for begin(addr, reset).
+    @return true on successful allocation/init, false otherwise.
+*/
+bool Adafruit_SH1107::beginFast(uint8_t addr, bool reset) {
+  _fast_boot = true;
+  bool ok = begin(addr, reset);
+  _fast_boot = false;
+  return ok;
+}
+
+/*!
+    @brief  As begin(addr, reset), but adopting a caller-provided
+            framebuffer instead of heap-allocating one -- zero heap use
+            after boot, and the buffer can live in a static/DMA-capable
+            region. See Adafruit_SH110X::setBuffer().
+    @param  fb
+            Framebuffer of at least WIDTH * ((HEIGHT + 7) / 8) bytes
+            (Adafruit_SH1107_T<W, H>::kBufferSize at compile time).
+    @param  len
+            Size of the provided buffer.
+    @param  addr
+            I2C address, as for begin(addr, reset).
+    @param  reset
+            Hard-reset policy, as for begin(addr, reset).
+    @return true on successful init, false on failure (including a
+            too-small buffer).
+*/
+bool Adafruit_SH1107::begin(uint8_t *fb, size_t len, uint8_t addr,
+                            bool reset) {
+  if (!setBuffer(fb, len)) {
+    return false;
+  }
+  return begin(addr, reset);
+}
@@ -39,6 +39,9 @@
 #include "Adafruit_SH110X.h"
 #include "splash.h"
 
+#define sh110x_swap(a, b)                                                      \
+  (((a) ^= (b)), ((b) ^= (a)), ((a) ^= (b))) ///< No-temp-var swap operation
+
 // CONSTRUCTORS, DESTRUCTOR ------------------------------------------------
 
 /*!
@@ -76,7 +79,10 @@
 Adafruit_SH110X::Adafruit_SH110X(uint16_t w, uint16_t h, TwoWire *twi,
                                  int16_t rst_pin, uint32_t clkDuring,
                                  uint32_t clkAfter)
-    : Adafruit_GrayOLED(1, w, h, twi, rst_pin, clkDuring, clkAfter) {}
+    : Adafruit_GrayOLED(1, w, h, twi, rst_pin, clkDuring, clkAfter) {
+  // panel RAM content is unknown at power-up, push everything once
+  _markAllDirty();
+}
 
 /*!
     @brief  Constructor for SPI SH110X displays, using software (bitbang)
@@ -107,7 +113,9 @@ Adafruit_SH110X::Adafruit_SH110X(uint16_t w, uint16_t h, TwoWire *twi,
 Adafruit_SH110X::Adafruit_SH110X(uint16_t w, uint16_t h, int16_t mosi_pin,
                                  int16_t sclk_pin, int16_t dc_pin,
                                  int16_t rst_pin, int16_t cs_pin)
-    : Adafruit_GrayOLED(1, w, h, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {}
+    : Adafruit_GrayOLED(1, w, h, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {
+  _markAllDirty();
+}
 
 /*!
     @brief  Constructor for SPI SH110X displays, using native hardware SPI.
@@ -137,114 +145,2276 @@ Adafruit_SH110X::Adafruit_SH110X(uint16_t w, uint16_t h, int16_t mosi_pin,
 Adafruit_SH110X::Adafruit_SH110X(uint16_t w, uint16_t h, SPIClass *spi,
                                  int16_t dc_pin, int16_t rst_pin,
                                  int16_t cs_pin, uint32_t bitrate)
-    : Adafruit_GrayOLED(1, w, h, spi, dc_pin, rst_pin, cs_pin, bitrate) {}
+    : Adafruit_GrayOLED(1, w, h, spi, dc_pin, rst_pin, cs_pin, bitrate) {
+  _markAllDirty();
+}
 
 /*!
     @brief  Destructor for Adafruit_SH110X object.
 */
-Adafruit_SH110X::~Adafruit_SH110X(void) {}
+Adafruit_SH110X::~Adafruit_SH110X(void) {
+  if (_shadow) {
+    free(_shadow);
+    _shadow = NULL;
+  }
+  if (_delta_ref) {
+    free(_delta_ref);
+    _delta_ref = NULL;
+  }
+  disableGlyphCache();
+  if (!_buffer_owned) {
+    // adopted via setBuffer() -- detach so the base class doesn't free a
+    // buffer the caller owns
+    buffer = NULL;
+  }
+}
+
+// FRAMEBUFFER ADOPTION ------------------------------------------------------
+
+/*!
+    @brief  Adopt a caller-provided framebuffer instead of having begin()
+            heap-allocate one -- e.g. a static array (sized with the
+            kBufferSize constant of the template classes), or memory
+            placed in a DMA-capable or non-cached region. Must be called
+            before begin(); the buffer is zeroed and never freed by the
+            library.
+    @param  fb
+            Pointer to at least WIDTH * ((HEIGHT + 7) / 8) bytes.
+    @param  len
+            Size of the provided buffer, checked against the above.
+    @return true if adopted, false if fb is NULL or len is too small.
+*/
+bool Adafruit_SH110X::setBuffer(uint8_t *fb, size_t len) {
+  size_t need = (size_t)WIDTH * ((HEIGHT + 7) / 8);
+  if (!fb || (len < need)) {
+    return false;
+  }
+  if (buffer && _buffer_owned) {
+    free(buffer);
+  }
+  buffer = fb;
+  _buffer_owned = false;
+  memset(buffer, 0, need);
+  _markAllDirty();
+  return true;
+}
+
+// DOUBLE BUFFERING ---------------------------------------------------------
+
+/*!
+    @brief  Enable or disable double-buffered (delta) rendering. When
+            enabled, display() compares the framebuffer against a shadow
+            copy of what is already on the panel and transmits only the
+            byte spans that actually changed, instead of the one bounding
+            rectangle tracked by the dirty window. Costs one extra
+            framebuffer worth of RAM.
+    @param  enable
+            true to allocate the shadow buffer and start delta updates,
+            false to free it and return to dirty-window transfers.
+    @return true on success, false if the shadow allocation failed (the
+            display keeps working in dirty-window mode in that case).
+    @note   The first display() call after enabling sends the dirty window
+            as usual and primes the shadow; deltas kick in from the second
+            call onward.
+*/
+bool Adafruit_SH110X::setDoubleBuffer(bool enable) {
+  if (!enable) {
+    if (_shadow) {
+      free(_shadow);
+      _shadow = NULL;
+    }
+    _shadow_valid = false;
+    return true;
+  }
+  if (_shadow) {
+    return true; // already on
+  }
+  _shadow = (uint8_t *)malloc((uint16_t)WIDTH * ((HEIGHT + 7) / 8));
+  _shadow_valid = false;
+  return (_shadow != NULL);
+}
+
+// HARDWARE SCROLLING -------------------------------------------------------
+
+/*!
+    @brief  Program the controller's display-start-line register. The
+            SH1107 takes the line as a command argument; the SH1106 packs
+            it into the command byte itself and overrides this.
+    @param  line
+            RAM line (0 to HEIGHT-1) to map onto the top display row.
+    @return true if the command was acknowledged.
+*/
+bool Adafruit_SH110X::oled_setStartLine(uint8_t line) {
+  uint8_t cmd[] = {SH110X_SETDISPSTARTLINE, line};
+  return oled_commandList(cmd, 2);
+}
+
+/*!
+    @brief  Scroll the visible image vertically by remapping the
+            controller's display start line -- a two-byte command instead
+            of moving and resending the framebuffer. The RAM-to-row
+            mapping wraps, so scrolling a text terminal one row costs this
+            command plus redrawing only the page that wrapped around:
+            draw the new text line into the buffer rows that just left the
+            top of the screen, and they reappear at the bottom.
+    @param  lines
+            Rows to scroll by; positive moves the image up. The running
+            offset wraps modulo the display height.
+    @note   The framebuffer itself is not touched: after scrolling,
+            buffer row y is shown at screen row (y - offset + HEIGHT) %
+            HEIGHT. Use getStartLine() to recover the current offset.
+*/
+void Adafruit_SH110X::scrollVertical(int16_t lines) {
+  int16_t line = ((int16_t)_display_start_line + lines) % HEIGHT;
+  if (line < 0) {
+    line += HEIGHT;
+  }
+  _display_start_line = line;
+  oled_setStartLine(_display_start_line);
+}
+
+/*!
+    @brief  Query the running display-start-line offset set up by
+            scrollVertical().
+    @return Buffer RAM line currently mapped to the top display row.
+*/
+uint8_t Adafruit_SH110X::getStartLine(void) { return _display_start_line; }
+
+// STREAMING MODE -----------------------------------------------------------
+
+/*!
+    @brief  Enter (or leave) buffer-less streaming mode. With a page source
+            registered, display() calls it once per page to generate the
+            display data into a small stack scratch buffer and sends that
+            out directly -- and the 1 KB-class framebuffer allocated by
+            begin() is freed, so static-layout UIs can run in ~128 bytes.
+    @param  source
+            Callback filling one page of vertical-byte data, or NULL to
+            leave streaming mode (the framebuffer is re-allocated then).
+    @param  user_data
+            Opaque pointer handed back to the callback.
+    @note   While streaming, the GFX drawing API (drawPixel() and
+            everything built on it) is inoperative since there is no
+            framebuffer to draw into; display() is also always a full
+            (blocking) frame push, as there is no dirty state to clip by.
+*/
+void Adafruit_SH110X::setPageSource(SH110X_PageSource source,
+                                    void *user_data) {
+  _page_source = source;
+  _page_source_arg = user_data;
+  if (source) {
+    if (buffer && _buffer_owned) {
+      free(buffer);
+      buffer = NULL;
+    }
+    if (_shadow) {
+      free(_shadow);
+      _shadow = NULL;
+      _shadow_valid = false;
+    }
+  } else if (!buffer) {
+    buffer = (uint8_t *)malloc((uint16_t)WIDTH * ((HEIGHT + 7) / 8));
+    if (buffer) {
+      memset(buffer, 0, (uint16_t)WIDTH * ((HEIGHT + 7) / 8));
+    }
+    _buffer_owned = true;
+    _markAllDirty();
+  }
+}
+
+// DIRTY TRACKING -----------------------------------------------------------
+
+/*!
+    @brief  Widen a page's dirty column span to include [x_min, x_max].
+    @param  page
+            Page index (each page is 8 rows tall).
+    @param  x_min
+            First touched framebuffer column.
+    @param  x_max
+            Last touched framebuffer column (inclusive).
+*/
+void Adafruit_SH110X::_markDirty(uint8_t page, uint8_t x_min, uint8_t x_max) {
+  if (page >= SH110X_MAX_PAGES) {
+    return;
+  }
+  _page_dirty_x1[page] = min(_page_dirty_x1[page], x_min);
+  _page_dirty_x2[page] = max(_page_dirty_x2[page], x_max);
+}
+
+/*!
+    @brief  Mark every page dirty across its full width, forcing the next
+            display call to push the whole framebuffer.
+*/
+void Adafruit_SH110X::_markAllDirty(void) {
+  // only the panel's real pages are marked: spans past (HEIGHT + 7) / 8
+  // would never be cleared by the display routines and leave
+  // framePending() stuck on panels shorter than 128 rows
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  for (uint8_t p = 0; p < SH110X_MAX_PAGES; p++) {
+    _page_dirty_x1[p] = (p < pages) ? 0 : 0xFF;
+    _page_dirty_x2[p] = (p < pages) ? (WIDTH - 1) : 0;
+  }
+}
+
+/*!
+    @brief  Mark every page clean (first dirty column past the last one).
+*/
+void Adafruit_SH110X::_resetDirtySpans(void) {
+  for (uint8_t p = 0; p < SH110X_MAX_PAGES; p++) {
+    _page_dirty_x1[p] = 0xFF;
+    _page_dirty_x2[p] = 0;
+  }
+}
+
+/*!
+    @brief  Set/clear/invert a single pixel. Same behavior as the base
+            Adafruit_GrayOLED implementation, but additionally maintains
+            the per-page dirty column spans consumed by the display
+            routines, so each page clips its transfer independently
+            instead of sharing one bounding rectangle.
+    @param  x
+            Column of display -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Row of display -- 0 at top to (screen height - 1) at bottom.
+    @param  color
+            Pixel color, one of: SH110X_BLACK, SH110X_WHITE or
+            SH110X_INVERSE.
+*/
+void Adafruit_SH110X::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (_glyph_capture) {
+    // glyph rasterization in progress: divert the pixel into the cache
+    // slot (page format, bit 0 on top) instead of the framebuffer
+    if ((x >= 0) && (x < _cap_w) && (y >= 0) && (y < _cap_h) && color) {
+      _cap_buf[(y / 8) * _cap_w + x] |= (uint8_t)(1 << (y & 7));
+    }
+    return;
+  }
+  if (!buffer) {
+    return; // streaming mode, no framebuffer to draw into
+  }
+  if ((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
+    // mirror the base class' rotation handling to find the physical
+    // page/column this pixel lands on
+    int16_t px = x, py = y;
+    switch (getRotation()) {
+    case 1:
+      sh110x_swap(px, py);
+      px = WIDTH - px - 1;
+      break;
+    case 2:
+      px = WIDTH - px - 1;
+      py = HEIGHT - py - 1;
+      break;
+    case 3:
+      sh110x_swap(px, py);
+      py = HEIGHT - py - 1;
+      break;
+    }
+    _markDirty(py / 8, (uint8_t)px, (uint8_t)px);
+  }
+  Adafruit_GrayOLED::drawPixel(x, y, color);
+}
+
+/*!
+    @brief  Convert a conventional horizontal-scan bitmap (the GFX
+            drawBitmap() layout -- rows of (w + 7) / 8 bytes, MSB first,
+            like splash1_data in splash.h) into the vertical-byte page
+            format drawBitmapFast(), SH110X_SpriteLayer and the panel RAM
+            itself use. Done once at asset load time (or offline), this
+            replaces the thousands of implicit drawPixel() calls a
+            drawBitmap() performs with a word-parallel 8x8 bit-matrix
+            transpose per tile -- microseconds instead of milliseconds
+            per image on a Cortex-M0.
+    @param  src
+            Horizontal-scan bitmap, h rows of (w + 7) / 8 bytes.
+    @param  w
+            Image width in pixels.
+    @param  h
+            Image height in pixels.
+    @param  dst
+            Output buffer of w * ((h + 7) / 8) bytes: (h + 7) / 8 bands
+            of w bytes, each byte one 8-pixel column strip, bit 0 on top.
+            Partial edge tiles are zero-padded.
+*/
+void Adafruit_SH110X::convertToPages(const uint8_t *src, uint16_t w,
+                                     uint16_t h, uint8_t *dst) {
+  uint16_t src_stride = (w + 7) / 8; // bytes per source row
+  uint16_t bands = (h + 7) / 8;
+
+  for (uint16_t band = 0; band < bands; band++) {
+    for (uint16_t xt = 0; xt < w; xt += 8) {
+      // gather one 8x8 tile, rows reversed so the transpose lands with
+      // bit 0 on top (the page-format convention) without a per-byte
+      // bit reversal afterwards
+      uint32_t a = 0, b = 0, t;
+      for (uint8_t r = 0; r < 8; r++) {
+        uint16_t yy = band * 8 + r;
+        uint8_t row =
+            (yy < h) ? src[(uint32_t)yy * src_stride + (xt / 8)] : 0;
+        if (r < 4) {
+          b |= (uint32_t)row << (r * 8);
+        } else {
+          a |= (uint32_t)row << ((r - 4) * 8);
+        }
+      }
+      // 8x8 bit-matrix transpose, two 32-bit halves (Hacker's Delight)
+      t = (a ^ (a >> 7)) & 0x00AA00AAUL;
+      a ^= t ^ (t << 7);
+      t = (b ^ (b >> 7)) & 0x00AA00AAUL;
+      b ^= t ^ (t << 7);
+      t = (a ^ (a >> 14)) & 0x0000CCCCUL;
+      a ^= t ^ (t << 14);
+      t = (b ^ (b >> 14)) & 0x0000CCCCUL;
+      b ^= t ^ (t << 14);
+      t = (a & 0xF0F0F0F0UL) | ((b >> 4) & 0x0F0F0F0FUL);
+      b = ((a << 4) & 0xF0F0F0F0UL) | (b & 0x0F0F0F0FUL);
+      a = t;
+      // scatter the transposed columns, clipping the right edge
+      uint8_t cols = ((w - xt) < 8) ? (uint8_t)(w - xt) : 8;
+      uint8_t *out = dst + (uint32_t)band * w + xt;
+      for (uint8_t c = 0; c < cols; c++) {
+        out[c] = (uint8_t)((c < 4) ? (a >> (24 - c * 8)) //
+                                   : (b >> (24 - (c - 4) * 8)));
+      }
+    }
+  }
+}
+
+/*!
+    @brief  Blit a pre-rotated, page-format (vertical byte) bitmap into
+            the framebuffer with whole-byte copies -- no per-pixel calls,
+            bounds math once per row of pages. Meant for glyph caches,
+            sprites and other assets already stored in the SH110X buffer
+            layout.
+    @param  x
+            Leftmost column; may be negative, the blit is clipped.
+    @param  y
+            Topmost row; must be a multiple of 8 (page aligned).
+    @param  data
+            Bitmap data: w bytes per 8-row band, h/8 bands, each byte one
+            column with bit 0 at the top (RAM, not PROGMEM).
+    @param  w
+            Bitmap width in pixels.
+    @param  h
+            Bitmap height in pixels; must be a multiple of 8.
+    @return true if the blit was performed (possibly clipped away), false
+            if the alignment/rotation preconditions do not hold -- fall
+            back to drawBitmap() then.
+*/
+bool Adafruit_SH110X::drawBitmapFast(int16_t x, int16_t y, const uint8_t *data,
+                                     uint8_t w, uint8_t h) {
+  if (!buffer || (getRotation() != 0) || (y & 7) || (h & 7)) {
+    return false;
+  }
+
+  // horizontal clip
+  int16_t x0 = (x < 0) ? 0 : x;
+  int16_t x1 = ((int16_t)(x + w) > WIDTH) ? WIDTH : (int16_t)(x + w);
+  if (x0 >= x1) {
+    return true; // fully off screen
+  }
+
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  uint8_t bands = h / 8;
+  for (uint8_t b = 0; b < bands; b++) {
+    int16_t page = y / 8 + b;
+    if ((page < 0) || (page >= pages)) {
+      continue; // vertical clip
+    }
+    memcpy(buffer + (uint16_t)page * (uint16_t)WIDTH + x0,
+           data + (uint16_t)b * w + (x0 - x), x1 - x0);
+    _markDirty(page, (uint8_t)x0, (uint8_t)(x1 - 1));
+    window_y1 = min(window_y1, (int16_t)(page * 8));
+    window_y2 = max(window_y2, (int16_t)(page * 8 + 7));
+  }
+  window_x1 = min(window_x1, x0);
+  window_x2 = max(window_x2, (int16_t)(x1 - 1));
+  return true;
+}
+
+/*!
+    @brief  Decode a run-length-encoded, page-format bitmap directly into
+            the framebuffer in byte-sized writes -- no per-pixel calls and
+            roughly half the flash of a raw asset for typical icons and
+            logos.
+
+            Asset format (packbits-flavored): a stream of control bytes
+            where 0x00..0x7F is followed by (control + 1) literal data
+            bytes, and 0x80..0xFF is followed by one data byte repeated
+            ((control & 0x7F) + 2) times. The decoded stream is the same
+            band-major vertical-byte layout drawBitmapFast() takes: w
+            bytes per 8-row band, h/8 bands.
+    @param  x
+            Leftmost column; may be negative, the blit is clipped.
+    @param  y
+            Topmost row; must be a multiple of 8 (page aligned).
+    @param  rle
+            Encoded asset (RAM, not PROGMEM).
+    @param  rle_len
+            Encoded length in bytes; decoding stops at whichever of the
+            input or the w*h/8 output bytes runs out first.
+    @param  w
+            Bitmap width in pixels.
+    @param  h
+            Bitmap height in pixels; must be a multiple of 8.
+    @return true if decoded (possibly clipped), false if the
+            alignment/rotation preconditions do not hold.
+*/
+bool Adafruit_SH110X::drawCompressedBitmap(int16_t x, int16_t y,
+                                           const uint8_t *rle,
+                                           uint16_t rle_len, uint8_t w,
+                                           uint8_t h) {
+  if (!buffer || (getRotation() != 0) || (y & 7) || (h & 7) || !w) {
+    return false;
+  }
+
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  uint8_t bands = h / 8;
+
+  uint16_t s = 0;    // input stream position
+  uint8_t band = 0;  // output band (8-row group) within the bitmap
+  uint8_t col = 0;   // output column within the band
+  int16_t page = y / 8;
+
+  while ((s < rle_len) && (band < bands)) {
+    uint8_t ctrl = rle[s++];
+    bool repeat = (ctrl & 0x80);
+    uint16_t run = repeat ? (uint16_t)((ctrl & 0x7F) + 2) : (uint16_t)(ctrl + 1);
+    uint8_t fill = 0;
+    if (repeat) {
+      if (s >= rle_len) {
+        break; // truncated stream
+      }
+      fill = rle[s++];
+    }
+    while (run && (band < bands)) {
+      uint8_t val = repeat ? fill : ((s < rle_len) ? rle[s++] : 0);
+      if ((page >= 0) && (page < pages)) {
+        int16_t tx = x + col;
+        if ((tx >= 0) && (tx < WIDTH)) {
+          buffer[(uint16_t)page * (uint16_t)WIDTH + tx] = val;
+        }
+      }
+      run--;
+      if (++col == w) {
+        col = 0;
+        band++;
+        page++;
+      }
+    }
+  }
+
+  // one dirty-state update for the whole blit
+  int16_t x0 = (x < 0) ? 0 : x;
+  int16_t x1 = ((int16_t)(x + w) > WIDTH) ? WIDTH : (int16_t)(x + w);
+  if (x0 < x1) {
+    for (uint8_t b = 0; b < bands; b++) {
+      int16_t p = y / 8 + b;
+      if ((p < 0) || (p >= pages)) {
+        continue;
+      }
+      _markDirty(p, (uint8_t)x0, (uint8_t)(x1 - 1));
+      window_y1 = min(window_y1, (int16_t)(p * 8));
+      window_y2 = max(window_y2, (int16_t)(p * 8 + 7));
+    }
+    window_x1 = min(window_x1, x0);
+    window_x2 = max(window_x2, (int16_t)(x1 - 1));
+  }
+  return true;
+}
+
+/*!
+    @brief  Fill a run of whole pages with a byte pattern in one memset
+            per page -- the fast path for panel backgrounds and bar
+            charts, instead of width*8 drawPixel() calls. The dirty state
+            is updated once for the whole run.
+    @param  first_page
+            First page (8-row group) to fill.
+    @param  last_page
+            Last page to fill (inclusive); clamped to the screen.
+    @param  pattern
+            Byte written to every column: each bit is one row within the
+            page, bit 0 on top. 0x00 clears, 0xFF sets, 0x55/0xAA
+            checkerboard, etc.
+*/
+void Adafruit_SH110X::fillPages(uint8_t first_page, uint8_t last_page,
+                                uint8_t pattern) {
+  if (!buffer) {
+    return;
+  }
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  if (first_page >= pages) {
+    return;
+  }
+  if (last_page >= pages) {
+    last_page = pages - 1;
+  }
+  for (uint8_t p = first_page; p <= last_page; p++) {
+    memset(buffer + (uint16_t)p * (uint16_t)WIDTH, pattern, WIDTH);
+    _markDirty(p, 0, WIDTH - 1);
+  }
+  window_x1 = 0;
+  window_x2 = WIDTH - 1;
+  window_y1 = min(window_y1, (int16_t)(first_page * 8));
+  window_y2 = max(window_y2, (int16_t)(last_page * 8 + 7));
+}
+
+/*!
+    @brief  Clear the whole framebuffer with one memset, bypassing the
+            per-pixel drawing path entirely.
+*/
+void Adafruit_SH110X::clearDisplayFast(void) {
+  fillPages(0, ((HEIGHT + 7) / 8) - 1, 0x00);
+}
+
+/*!
+    @brief  Invert a rectangular region by XORing the framebuffer bytes
+            directly -- one masked XOR per column per page instead of a
+            drawPixel() call per pixel. Useful for selection highlights
+            and cursors.
+    @param  x
+            Left edge, in current-rotation display coordinates.
+    @param  y
+            Top edge.
+    @param  w
+            Region width in pixels.
+    @param  h
+            Region height in pixels.
+*/
+void Adafruit_SH110X::invertRegion(int16_t x, int16_t y, int16_t w,
+                                   int16_t h) {
+  if (!buffer || (w <= 0) || (h <= 0)) {
+    return;
+  }
+
+  // rotate the rectangle into the panel's native frame (it stays
+  // axis-aligned under 90-degree rotations)
+  int16_t px, py, pw, ph;
+  switch (getRotation()) {
+  case 1:
+    px = WIDTH - y - h;
+    py = x;
+    pw = h;
+    ph = w;
+    break;
+  case 2:
+    px = WIDTH - x - w;
+    py = HEIGHT - y - h;
+    pw = w;
+    ph = h;
+    break;
+  case 3:
+    px = y;
+    py = HEIGHT - x - w;
+    pw = h;
+    ph = w;
+    break;
+  default:
+    px = x;
+    py = y;
+    pw = w;
+    ph = h;
+    break;
+  }
+
+  // clip to the screen
+  int16_t x0 = (px < 0) ? 0 : px;
+  int16_t x1 = ((px + pw) > WIDTH) ? WIDTH : (px + pw);   // exclusive
+  int16_t y0 = (py < 0) ? 0 : py;
+  int16_t y1 = ((py + ph) > HEIGHT) ? HEIGHT : (py + ph); // exclusive
+  if ((x0 >= x1) || (y0 >= y1)) {
+    return;
+  }
+
+  for (uint8_t p = y0 / 8; p <= (uint8_t)((y1 - 1) / 8); p++) {
+    // rows of this page covered by the region
+    uint8_t lo = max((int16_t)(p * 8), y0) & 7;
+    uint8_t hi = min((int16_t)(p * 8 + 7), (int16_t)(y1 - 1)) & 7;
+    uint8_t mask = (uint8_t)((0xFF << lo) & (0xFF >> (7 - hi)));
+    uint8_t *row = buffer + (uint16_t)p * (uint16_t)WIDTH;
+    for (int16_t c = x0; c < x1; c++) {
+      row[c] ^= mask;
+    }
+    _markDirty(p, (uint8_t)x0, (uint8_t)(x1 - 1));
+  }
+  window_x1 = min(window_x1, x0);
+  window_x2 = max(window_x2, (int16_t)(x1 - 1));
+  window_y1 = min(window_y1, y0);
+  window_y2 = max(window_y2, (int16_t)(y1 - 1));
+}
+
+/*!
+    @brief  Clear the framebuffer completely (writes are not visible until
+            the next display call). All pages are marked dirty.
+*/
+void Adafruit_SH110X::clearDisplay(void) {
+  if (!buffer) {
+    return; // streaming mode, no framebuffer to clear
+  }
+  Adafruit_GrayOLED::clearDisplay();
+  _markAllDirty();
+}
+
+// INSTRUMENTATION ----------------------------------------------------------
+
+#ifdef SH110X_PROFILE
+/*!
+    @brief  Fold one finished frame into the cumulative statistics.
+    @param  start_us
+            micros() timestamp taken when the display call began.
+*/
+void Adafruit_SH110X::_profileFrame(uint32_t start_us) {
+  uint32_t took = micros() - start_us;
+  _stats.last_us = took;
+  _stats.total_us += took;
+  if (!_stats.frames || (took < _stats.min_us)) {
+    _stats.min_us = took;
+  }
+  if (took > _stats.max_us) {
+    _stats.max_us = took;
+  }
+  _stats.frames++;
+}
+
+/*!
+    @brief  Fetch the statistics accumulated since the last
+            resetFrameStats() (or since boot).
+    @return Copy of the counters, see SH110X_FrameStats.
+*/
+SH110X_FrameStats Adafruit_SH110X::getFrameStats(void) { return _stats; }
+
+/*!
+    @brief  Zero all frame statistics counters.
+*/
+void Adafruit_SH110X::resetFrameStats(void) {
+  memset(&_stats, 0, sizeof(_stats));
+}
+#endif // SH110X_PROFILE
 
 // REFRESH DISPLAY ---------------------------------------------------------
 
 /*!
-    @brief  Push data currently in RAM to SH110X display.
-    @note   Drawing operations are not visible until this function is
-            called. Call after each graphics command, or after a whole set
-            of graphics commands, as best needed by one's own application.
+    @brief  Opt in to SH1107 vertical-addressing frame bursts: when every
+            page is dirty across the full width (full redraws, cleared
+            screens, full-frame animation), display() streams the whole
+            frame as one continuous data burst behind a single addressing
+            preamble, instead of paying a 3-4 byte page/column command
+            preamble per page (16 of them on a 128x128). Narrow dirty
+            windows keep using the per-page span loop, which transmits
+            fewer data bytes.
+    @param  enable
+            true to use vertical bursts where eligible, false to always
+            use the per-page loop.
+    @return true if the request took effect, false if this controller
+            has no vertical addressing mode (SH1106G).
 */
-void Adafruit_SH110X::display(void) {
-  // ESP8266 needs a periodic yield() call to avoid watchdog reset.
-  // With the limited size of SH110X displays, and the fast bitrate
-  // being used (1 MHz or more), I think one yield() immediately before
-  // a screen write and one immediately after should cover it.  But if
-  // not, if this becomes a problem, yields() might be added in the
-  // 32-byte transfer condition below.
-  yield();
+bool Adafruit_SH110X::setVerticalTransfers(bool enable) {
+  _vertical_transfers = enable && _vertical_ok;
+  return !enable || _vertical_transfers;
+}
 
-  // uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-  uint8_t *ptr = buffer;
-  uint8_t dc_byte = 0x40;
+/*!
+    @brief  Route the frame-transfer path through a pluggable backend
+            instead of the built-in I2C/SPI code: each refresh queues its
+            page addressing and data runs on the transport and flushes
+            once per frame, so a platform backend (DMA descriptor
+            chains, ESP32 hardware command linking, async drivers) can
+            submit the whole frame in one go. The stock
+            SH110X_I2CTransport / SH110X_SPITransport reproduce the
+            built-in behavior. Control traffic outside the refresh path
+            (contrast, sleep, init) stays on the BusIO device, so a
+            custom transport must share the bus peacefully with it.
+    @param  transport
+            Backend to install (must outlive the display), or NULL to
+            restore the built-in path.
+*/
+void Adafruit_SH110X::setTransport(SH110X_Transport *transport) {
+  _transport = transport;
+  _transport_hold = false;
+}
+
+/*!
+    @brief  Send the whole frame as one SH1107 vertical-addressing burst:
+            one preamble (vertical mode, page 0, start column), then
+            WIDTH x 16 data bytes gathered column-major from the
+            page-major framebuffer, then back to page addressing. The
+            hardware wraps the page address at 15 before advancing the
+            column, so this is only valid when the framebuffer covers
+            all 16 hardware pages and every page is fully dirty;
+            anything else returns false and the caller falls back to the
+            per-page loop.
+    @return true if the frame was transmitted, false if ineligible or a
+            bus write failed (dirty state is then left for the fallback).
+*/
+bool Adafruit_SH110X::_sendFrameVertical(void) {
   uint8_t pages = ((HEIGHT + 7) / 8);
+  if (pages != 16) {
+    return false; // vertical wrap is hardwired at page 15
+  }
+  if (_transport) {
+    // the column-major gather lives in a stack scratch buffer, which a
+    // deferred zero-copy queue would dangle on; use the page loop
+    return false;
+  }
+  for (uint8_t p = 0; p < pages; p++) {
+    if ((_page_dirty_x1[p] != 0) || (_page_dirty_x2[p] != WIDTH - 1)) {
+      return false; // narrow window, the span loop transmits less
+    }
+  }
+
+  uint8_t scratch[128]; // column-major gather, 16 bytes per column
+  uint8_t cols_per_chunk = sizeof(scratch) / 16;
+  if (i2c_dev) {
+    uint16_t maxbuff = i2c_dev->maxBufferSize();
+    if (maxbuff < 1 + 16) {
+      return false; // not even one column per transaction fits
+    }
+    uint8_t fit = (maxbuff - 1) / 16;
+    cols_per_chunk = min(cols_per_chunk, fit);
+  } else if (!_spi_frame_hold) {
+    return false; // SPI path relies on display()'s held transaction
+  }
+
+  uint8_t col0 = _page_start_offset;
+  uint8_t pre[] = {SH110X_MEMORYMODE_VERTICAL, SH110X_SETPAGEADDR,
+                   (uint8_t)(0x10 + (col0 >> 4)), (uint8_t)(col0 & 0xF)};
+#ifdef SH110X_PROFILE
+  uint32_t t = micros();
+#endif
+  bool ok = true;
+
+  if (i2c_dev) {
+    const uint8_t ctrl_cmd = 0x00;
+    uint8_t ctrl_data = 0x40;
+    if (!_i2c_speed_hold) {
+      i2c_dev->setSpeed(i2c_preclk);
+    }
+    ok = i2c_dev->write(pre, sizeof(pre), true, &ctrl_cmd, 1);
+    for (uint8_t c = 0; ok && (c < WIDTH); c += cols_per_chunk) {
+      uint8_t n = min(cols_per_chunk, (uint8_t)(WIDTH - c));
+      for (uint8_t j = 0; j < n; j++) {
+        for (uint8_t p = 0; p < 16; p++) {
+          scratch[j * 16 + p] = buffer[(uint16_t)p * (uint16_t)WIDTH + c + j];
+        }
+      }
+      ok = i2c_dev->write(scratch, (uint16_t)n * 16, true, &ctrl_data, 1);
+      yield();
+    }
+    // back to page addressing for the regular send paths -- attempted
+    // even after a failed data chunk, or the per-page fallback loop
+    // would write into a panel still auto-incrementing vertically and
+    // garble it while "succeeding" (clearing the dirty spans for good)
+    uint8_t back = SH110X_MEMORYMODE;
+    bool restored = i2c_dev->write(&back, 1, true, &ctrl_cmd, 1);
+    if (restored) {
+      _vmode_untrusted = false; // panel is back in page addressing
+    }
+    ok = ok && restored;
+    if (!_i2c_speed_hold) {
+      i2c_dev->setSpeed(i2c_postclk);
+    }
+    if (!ok) {
+      _busError();
+    }
+    if (!restored) {
+      // addressing mode is untrusted: have the next page-mode transfer
+      // reassert it (the per-page preamble alone never sends 0x20) and
+      // force a full resend of anything a misaddressed write could have
+      // garbled in the meantime
+      _vmode_untrusted = true;
+      _markAllDirty();
+    }
+  } else { // SPI, inside the frame-held transaction
+    digitalWrite(dcPin, LOW);
+    spi_dev->transfer(pre, sizeof(pre)); // local scratch, clobber is fine
+    digitalWrite(dcPin, HIGH);
+    for (uint8_t c = 0; c < WIDTH; c += cols_per_chunk) {
+      uint8_t n = min(cols_per_chunk, (uint8_t)(WIDTH - c));
+      for (uint8_t j = 0; j < n; j++) {
+        for (uint8_t p = 0; p < 16; p++) {
+          scratch[j * 16 + p] = buffer[(uint16_t)p * (uint16_t)WIDTH + c + j];
+        }
+      }
+      spi_dev->transfer(scratch, (uint16_t)n * 16);
+    }
+    digitalWrite(dcPin, LOW);
+    spi_dev->transfer(SH110X_MEMORYMODE);
+    digitalWrite(dcPin, HIGH);
+  }
+
+  if (ok) {
+#ifdef SH110X_PROFILE
+    _stats.data_us += micros() - t;
+    _stats.cmd_bytes += sizeof(pre) + 2;
+    _stats.data_bytes += (uint32_t)WIDTH * 16;
+    _stats.pages_sent += pages;
+#endif
+    _bus_error_count = 0;
+  }
+  return ok;
+}
+
+/*!
+    @brief  Open a frame-scoped bus hold: one SPI transaction (CS
+            asserted) for the whole frame so per-page sends skip
+            transaction setup and CS edges, or -- with a pluggable
+            transport installed -- defer its flush() so the page queue
+            accumulates the whole frame for one submission. No-op for
+            the plain I2C path or when already held.
+*/
+void Adafruit_SH110X::_spiFrameBegin(void) {
+  if (_transport) {
+    _transport_hold = true;
+    return;
+  }
+  if (spi_dev && !_spi_frame_hold) {
+    spi_dev->beginTransactionWithAssertingCS();
+    _spi_frame_hold = true;
+  }
+}
+
+/*!
+    @brief  Close the frame scope opened by _spiFrameBegin(): release
+            CS, or flush the transport's queued frame. A failed flush
+            re-marks everything dirty (and drops the delta shadow) so
+            the next display call resends what the panel never got.
+*/
+void Adafruit_SH110X::_spiFrameEnd(void) {
+  if (_transport) {
+    if (_transport_hold) {
+      _transport_hold = false;
+      if (!_transport->flush()) {
+        _markAllDirty();
+        _shadow_valid = false; // shadow no longer matches the panel
+      }
+    }
+    return;
+  }
+  if (spi_dev && _spi_frame_hold) {
+    spi_dev->endTransactionWithDeassertingCS();
+    _spi_frame_hold = false;
+  }
+}
 
+/*!
+    @brief  Send one page worth of display data from an arbitrary source
+            buffer (the framebuffer, a streaming scratch page, ...).
+    @param  page_data
+            Pointer to the page's column 0 data byte, WIDTH bytes long.
+    @param  page
+            Page index (each page is 8 rows tall) the data is sent to.
+    @param  col_start
+            First column to send.
+    @param  col_end
+            Last column to send (inclusive).
+    @return true on success, false if a bus write failed.
+*/
+bool Adafruit_SH110X::_sendPageBuf(const uint8_t *page_data, uint8_t page,
+                                   uint8_t col_start, uint8_t col_end) {
+#ifdef SH110X_PROFILE
+  uint32_t t = 0;
+#endif
+  uint8_t dc_byte = 0x40;
   uint8_t bytes_per_page = WIDTH;
 
-  /*
-  Serial.print("Window: (");
-  Serial.print(window_x1);
-  Serial.print(", ");
-  Serial.print(window_y1);
-  Serial.print(" -> (");
-  Serial.print(window_x2);
-  Serial.print(", ");
-  Serial.print(window_y2);
-  Serial.println(")");
-  */
-
-  uint8_t first_page = window_y1 / 8;
-  //  uint8_t last_page = (window_y2 + 7) / 8;
-  uint8_t page_start = min(bytes_per_page, (uint8_t)window_x1);
-  uint8_t page_end = (uint8_t)max((int)0, (int)window_x2);
-  /*
-  Serial.print("Pages: ");
-  Serial.print(first_page);
-  Serial.print(" -> ");
-  Serial.println(last_page);
-  pages = min(pages, last_page);
-
-  Serial.print("Page addr: ");
-  Serial.print(page_start);
-  Serial.print(" -> ");
-  Serial.println(page_end);
-  */
-
-  for (uint8_t p = first_page; p < pages; p++) {
-    uint8_t bytes_remaining = bytes_per_page;
-    ptr = buffer + (uint16_t)p * (uint16_t)bytes_per_page;
-    // fast forward to dirty rectangle beginning
-    ptr += page_start;
-    bytes_remaining -= page_start;
-    // cut off end of dirty rectangle
-    bytes_remaining -= (WIDTH - 1) - page_end;
-
-    if (i2c_dev) { // I2C
-      uint16_t maxbuff = i2c_dev->maxBufferSize() - 1;
+  uint8_t bytes_remaining = bytes_per_page;
+  const uint8_t *ptr = page_data;
+  // fast forward to dirty rectangle beginning
+  ptr += col_start;
+  bytes_remaining -= col_start;
+  // cut off end of dirty rectangle
+  bytes_remaining -= (WIDTH - 1) - col_end;
 
-      uint8_t cmd[] = {
-          0x00, (uint8_t)(SH110X_SETPAGEADDR + p),
-          (uint8_t)(0x10 + ((page_start + _page_start_offset) >> 4)),
-          (uint8_t)((page_start + _page_start_offset) & 0xF)};
+  if (_transport) { // pluggable backend
+    uint8_t cmd[] = {
+        (uint8_t)(SH110X_SETPAGEADDR + page),
+        (uint8_t)(0x10 + ((col_start + _page_start_offset) >> 4)),
+        (uint8_t)((col_start + _page_start_offset) & 0xF)};
+    if (!_transport->queueCommand(cmd, sizeof(cmd)) ||
+        !_transport->queueData(ptr, bytes_remaining)) {
+      return false; // queue full: span stays dirty, retried next frame
+    }
+#ifdef SH110X_PROFILE
+    _stats.cmd_bytes += sizeof(cmd);
+    _stats.data_bytes += bytes_remaining;
+    _stats.pages_sent++;
+#endif
+    if (_transport_hold) {
+      // display() batches the whole frame into one flush at frame end
+      return true;
+    }
+    return _transport->flush();
+  }
 
-      // Set high speed clk
+  if (i2c_dev) { // I2C
+    uint16_t maxbuff = i2c_dev->maxBufferSize();
+
+    // The page/column addressing commands and the first data chunk share
+    // a single transaction: each command byte is framed by a 0x80 control
+    // byte (Co=1, D/C=0), then one 0x40 control byte switches the rest of
+    // the transaction to data. Saves an I2C start/stop plus address byte
+    // per page compared to a separate command write.
+    uint8_t preamble[] = {
+        0x80, (uint8_t)(SH110X_SETPAGEADDR + page),
+        0x80, (uint8_t)(0x10 + ((col_start + _page_start_offset) >> 4)),
+        0x80, (uint8_t)((col_start + _page_start_offset) & 0xF),
+        0x40};
+
+    // Set high speed clk (unless a display group already holds it)
+    if (!_i2c_speed_hold) {
       i2c_dev->setSpeed(i2c_preclk);
+    }
+
+    if (_vmode_untrusted) {
+      // a failed vertical burst may have left the panel auto-
+      // incrementing vertically; reassert page addressing before
+      // trusting the per-page preambles below
+      uint8_t mode = SH110X_MEMORYMODE;
+      uint8_t ctrl = 0x00;
+      if (!i2c_dev->write(&mode, 1, true, &ctrl, 1)) {
+        _busError();
+        if (!_i2c_speed_hold) {
+          i2c_dev->setSpeed(i2c_postclk);
+        }
+        return false;
+      }
+      _vmode_untrusted = false;
+    }
 
-      i2c_dev->write(cmd, 4);
+    if (maxbuff > sizeof(preamble)) {
+      uint8_t to_write =
+          min(bytes_remaining, (uint8_t)(maxbuff - sizeof(preamble)));
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      if (!i2c_dev->write(ptr, to_write, true, preamble, sizeof(preamble))) {
+        _busError();
+        if (!_i2c_speed_hold) {
+          i2c_dev->setSpeed(i2c_postclk);
+        }
+        return false;
+      }
+#ifdef SH110X_PROFILE
+      _stats.data_us += micros() - t;
+      _stats.cmd_bytes += sizeof(preamble);
+      _stats.data_bytes += to_write;
+#endif
+      ptr += to_write;
+      bytes_remaining -= to_write;
+    } else {
+      // transport buffer too small to coalesce, send commands on their own
+      uint8_t cmd[] = {
+          0x00, (uint8_t)(SH110X_SETPAGEADDR + page),
+          (uint8_t)(0x10 + ((col_start + _page_start_offset) >> 4)),
+          (uint8_t)((col_start + _page_start_offset) & 0xF)};
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      if (!i2c_dev->write(cmd, 4)) {
+        _busError();
+        if (!_i2c_speed_hold) {
+          i2c_dev->setSpeed(i2c_postclk);
+        }
+        return false;
+      }
+#ifdef SH110X_PROFILE
+      _stats.cmd_us += micros() - t;
+      _stats.cmd_bytes += 4;
+#endif
+    }
 
-      while (bytes_remaining) {
-        uint8_t to_write = min(bytes_remaining, (uint8_t)maxbuff);
-        i2c_dev->write(ptr, to_write, true, &dc_byte, 1);
-        ptr += to_write;
-        bytes_remaining -= to_write;
-        yield();
+    while (bytes_remaining) {
+      // follow-on chunks only pay the single 0x40 control-byte prefix
+      uint8_t to_write = min(bytes_remaining, (uint8_t)(maxbuff - 1));
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      if (!i2c_dev->write(ptr, to_write, true, &dc_byte, 1)) {
+        _busError();
+        if (!_i2c_speed_hold) {
+          i2c_dev->setSpeed(i2c_postclk);
+        }
+        return false;
       }
+#ifdef SH110X_PROFILE
+      _stats.data_us += micros() - t;
+      _stats.cmd_bytes += 1;
+      _stats.data_bytes += to_write;
+#endif
+      ptr += to_write;
+      bytes_remaining -= to_write;
+      yield();
+    }
 
-      // Set low speed clk
+    // Set low speed clk
+    if (!_i2c_speed_hold) {
       i2c_dev->setSpeed(i2c_postclk);
+    }
 
-    } else { // SPI
-      uint8_t cmd[] = {
-          (uint8_t)(SH110X_SETPAGEADDR + p),
-          (uint8_t)(0x10 + ((page_start + _page_start_offset) >> 4)),
-          (uint8_t)((page_start + _page_start_offset) & 0xF)};
+  } else { // SPI
+    uint8_t cmd[] = {
+        (uint8_t)(SH110X_SETPAGEADDR + page),
+        (uint8_t)(0x10 + ((col_start + _page_start_offset) >> 4)),
+        (uint8_t)((col_start + _page_start_offset) & 0xF)};
 
+    if (_spi_frame_hold) {
+      // display() holds one transaction (CS asserted) across the whole
+      // frame: stream straight out of the caller's buffer with per-byte
+      // transfers -- the same inner loop write() uses -- but without
+      // paying transaction begin/end and CS edges per page, which is
+      // where the dead time between pages goes at 8 MHz.
+      digitalWrite(dcPin, LOW);
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      spi_dev->transfer(cmd, 3); // local scratch, in-place clobber is fine
+#ifdef SH110X_PROFILE
+      _stats.cmd_us += micros() - t;
+      _stats.cmd_bytes += 3;
+#endif
+      digitalWrite(dcPin, HIGH);
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      for (uint8_t i = 0; i < bytes_remaining; i++) {
+        spi_dev->transfer(ptr[i]);
+      }
+#ifdef SH110X_PROFILE
+      _stats.data_us += micros() - t;
+      _stats.data_bytes += bytes_remaining;
+#endif
+    } else {
       digitalWrite(dcPin, LOW);
-      spi_dev->write(cmd, 3);
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      if (!spi_dev->write(cmd, 3)) {
+        return false;
+      }
+#ifdef SH110X_PROFILE
+      _stats.cmd_us += micros() - t;
+      _stats.cmd_bytes += 3;
+#endif
       digitalWrite(dcPin, HIGH);
-      spi_dev->write(ptr, bytes_remaining);
+#ifdef SH110X_PROFILE
+      t = micros();
+#endif
+      if (!spi_dev->write(ptr, bytes_remaining)) {
+        return false;
+      }
+#ifdef SH110X_PROFILE
+      _stats.data_us += micros() - t;
+      _stats.data_bytes += bytes_remaining;
+#endif
     }
   }
-  // reset dirty window
-  window_x1 = 1024;
-  window_y1 = 1024;
-  window_x2 = -1;
-  window_y2 = -1;
+
+#ifdef SH110X_PROFILE
+  _stats.pages_sent++;
+#endif
+  _bus_error_count = 0; // healthy transfer, reset the downshift counter
+  return true;
+}
+
+/*!
+    @brief  Send one page of the framebuffer to the display.
+    @param  page
+            Page index (each page is 8 rows tall).
+    @param  col_start
+            First framebuffer column to send.
+    @param  col_end
+            Last framebuffer column to send (inclusive).
+    @return true on success, false if a bus write failed.
+*/
+bool Adafruit_SH110X::_sendPage(uint8_t page, uint8_t col_start,
+                                uint8_t col_end) {
+  return _sendPageBuf(buffer + (uint16_t)page * (uint16_t)WIDTH, page,
+                      col_start, col_end);
+}
+
+/*!
+    @brief  As _sendPageBuf(), but retrying a failed transfer up to
+            SH110X_PAGE_RETRIES extra times. A NAK mid-frame (EMI, a
+            marginal bus) is usually transient; resending the page
+            immediately turns it into a non-event instead of leaving the
+            panel showing a half-written page.
+    @param  page_data
+            Pointer to WIDTH bytes of page data to transmit from.
+    @param  page
+            Page index (each page is 8 rows tall).
+    @param  col_start
+            First framebuffer column to send.
+    @param  col_end
+            Last framebuffer column to send (inclusive).
+    @return true on success, false if every attempt failed.
+*/
+bool Adafruit_SH110X::_sendPageBufRetried(const uint8_t *page_data,
+                                          uint8_t page, uint8_t col_start,
+                                          uint8_t col_end) {
+  for (uint8_t attempt = 0;; attempt++) {
+    if (_sendPageBuf(page_data, page, col_start, col_end)) {
+      return true;
+    }
+    if (attempt >= SH110X_PAGE_RETRIES) {
+      return false;
+    }
+#ifdef SH110X_PROFILE
+    _stats.retries++;
+#endif
+  }
+}
+
+/*!
+    @brief  As _sendPage(), but with the retry policy of
+            _sendPageBufRetried().
+    @param  page
+            Page index (each page is 8 rows tall).
+    @param  col_start
+            First framebuffer column to send.
+    @param  col_end
+            Last framebuffer column to send (inclusive).
+    @return true on success, false if every attempt failed.
+*/
+bool Adafruit_SH110X::_sendPageRetried(uint8_t page, uint8_t col_start,
+                                       uint8_t col_end) {
+  return _sendPageBufRetried(buffer + (uint16_t)page * (uint16_t)WIDTH, page,
+                             col_start, col_end);
+}
+
+/*!
+    @brief  Push data currently in RAM to SH110X display.
+    @note   Drawing operations are not visible until this function is
+            called. Call after each graphics command, or after a whole set
+            of graphics commands, as best needed by one's own application.
+*/
+void Adafruit_SH110X::display(void) {
+#ifdef SH110X_PROFILE
+  uint32_t frame_start = micros();
+#endif
+  // a blocking display() supersedes any async frame still in flight
+  _async_active = false;
+
+  if (_page_source) {
+    // Streaming mode: no framebuffer, the application generates each page
+    // into a small stack scratch buffer which is pushed out immediately.
+    uint8_t scratch[132]; // widest SH110X column RAM
+    if ((uint8_t)WIDTH > sizeof(scratch)) {
+      return;
+    }
+    yield();
+    uint8_t pages = ((HEIGHT + 7) / 8);
+    _spiFrameBegin();
+    for (uint8_t p = 0; p < pages; p++) {
+      _page_source(p, scratch, _page_source_arg);
+      _sendPageBufRetried(scratch, p, 0, WIDTH - 1);
+      if (_transport) {
+        _transport->flush(); // scratch is reused next page, can't defer
+      }
+    }
+    _spiFrameEnd();
+#ifdef SH110X_PROFILE
+    _profileFrame(frame_start);
+#endif
+    return;
+  }
+
+  // ESP8266 needs a periodic yield() call to avoid watchdog reset.
+  // With the limited size of SH110X displays, and the fast bitrate
+  // being used (1 MHz or more), I think one yield() immediately before
+  // a screen write and one immediately after should cover it.  But if
+  // not, if this becomes a problem, yields() might be added in the
+  // 32-byte transfer condition below.
+  yield();
+
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  uint8_t bytes_per_page = WIDTH;
+
+  // one transaction/CS assertion for the whole frame on SPI, so the
+  // per-page sends below run back to back with no inter-page dead time
+  _spiFrameBegin();
+
+  if (_shadow && _shadow_valid) {
+    // Delta mode: diff each page against the shadow copy of the panel
+    // contents, chunk by chunk, and transmit only the spans that changed.
+    // Disjoint damage (e.g. opposite screen corners) no longer drags the
+    // whole bounding rectangle along.
+    const uint8_t chunksize = 16;
+    for (uint8_t p = 0; p < pages; p++) {
+      uint8_t *live = buffer + (uint16_t)p * (uint16_t)bytes_per_page;
+      uint8_t *seen = _shadow + (uint16_t)p * (uint16_t)bytes_per_page;
+#ifdef SH110X_PROFILE
+      bool page_touched = false;
+#endif
+      uint8_t c = 0;
+      while (c < bytes_per_page) {
+        uint8_t chunk = min(chunksize, (uint8_t)(bytes_per_page - c));
+        if (!memcmp(live + c, seen + c, chunk)) {
+          c += chunk;
+          continue;
+        }
+        // grow the span across consecutive dirty chunks
+        uint8_t span_start = c;
+        uint8_t span_end = c + chunk - 1;
+        c += chunk;
+        while (c < bytes_per_page) {
+          chunk = min(chunksize, (uint8_t)(bytes_per_page - c));
+          if (!memcmp(live + c, seen + c, chunk)) {
+            break;
+          }
+          span_end = c + chunk - 1;
+          c += chunk;
+        }
+        if (_sendPageRetried(p, span_start, span_end)) {
+          memcpy(seen + span_start, live + span_start,
+                 span_end - span_start + 1);
+        }
+        // on persistent failure the shadow keeps the panel's (stale)
+        // contents, so the next display() diff resends just this span
+#ifdef SH110X_PROFILE
+        page_touched = true;
+#endif
+      }
+#ifdef SH110X_PROFILE
+      if (!page_touched) {
+        _stats.pages_skipped++;
+      }
+#endif
+    }
+    _resetDirtySpans();
+  } else {
+    // each page clips its transfer to its own dirty span, so disjoint
+    // updates (two text lines, say) cost two short bursts instead of a
+    // half-screen sweep
+    bool all_sent = true;
+    if (_vertical_transfers && _sendFrameVertical()) {
+      // the whole frame went out as one vertical-addressing burst
+      _resetDirtySpans();
+    } else {
+      for (uint8_t p = 0; p < pages; p++) {
+        if (_page_dirty_x1[p] > _page_dirty_x2[p]) {
+#ifdef SH110X_PROFILE
+          _stats.pages_skipped++;
+#endif
+          continue; // page untouched since last refresh
+        }
+        if (_sendPageRetried(p, _page_dirty_x1[p], _page_dirty_x2[p])) {
+          _page_dirty_x1[p] = 0xFF; // delivered, page is clean again
+          _page_dirty_x2[p] = 0;
+        } else {
+          // persistent bus failure: leave the span standing so the next
+          // display() resends just the missing region, not the whole
+          // frame
+          all_sent = false;
+        }
+      }
+    }
+
+    if (_shadow && all_sent) {
+      // prime the shadow so the next display() can go delta-only
+      memcpy(_shadow, buffer, (uint16_t)pages * (uint16_t)bytes_per_page);
+      _shadow_valid = true;
+    }
+  }
+  _spiFrameEnd();
+  // reset dirty window
+  window_x1 = 1024;
+  window_y1 = 1024;
+  window_x2 = -1;
+  window_y2 = -1;
+
+  _last_frame_us = micros();
+#ifdef SH110X_PROFILE
+  _profileFrame(frame_start);
+#endif
+}
+
+// FAST BOOT ----------------------------------------------------------------
+
+/*!
+    @brief  Set the settle time beginFast() waits between the init
+            sequence and SH110X_DISPLAYON. The plain begin() keeps the
+            datasheet-conservative 100 ms, which covers worst-case
+            charge-pump soak over temperature and supply; most modules
+            are visually stable far sooner, so wake-show-sleep devices
+            can trim this to what their hardware actually needs.
+    @param  ms
+            Milliseconds to wait in beginFast(). Default is 2.
+*/
+void Adafruit_SH110X::setFastBootDelay(uint8_t ms) {
+  _fast_boot_delay_ms = ms;
+}
+
+// GLYPH CACHE --------------------------------------------------------------
+
+/*!
+    @brief  Allocate the glyph cache: classic-font characters are
+            rasterized once (per text size) into vertical-byte page
+            format on first use, and every later draw is serviced by the
+            byte-blit path -- text cost becomes O(bytes) instead of
+            O(pixels), which on per-field telemetry screens is most of
+            the render CPU. The cache covers the built-in 6x8 font at
+            scale 1 or 2 and rotation 0; custom GFX fonts, larger
+            scales and rotated text fall back to the normal GFX path.
+    @param  slots
+            Pool capacity in glyphs (28 bytes each); 64 covers the
+            printable ASCII working set of a typical status screen.
+            0 disables the cache, like disableGlyphCache().
+    @return true on success, false if the pool allocation failed.
+*/
+bool Adafruit_SH110X::enableGlyphCache(uint8_t slots) {
+  disableGlyphCache();
+  if (!slots) {
+    return true;
+  }
+  _glyph_pool = (GlyphSlot *)malloc((size_t)slots * sizeof(GlyphSlot));
+  if (!_glyph_pool) {
+    return false;
+  }
+  for (uint8_t i = 0; i < slots; i++) {
+    _glyph_pool[i].used = 0;
+  }
+  _glyph_slots = slots;
+  _glyph_victim = 0;
+  return true;
+}
+
+/*!
+    @brief  Free the glyph cache and return text rendering to the plain
+            GFX per-pixel path.
+*/
+void Adafruit_SH110X::disableGlyphCache(void) {
+  if (_glyph_pool) {
+    free(_glyph_pool);
+    _glyph_pool = NULL;
+  }
+  _glyph_slots = 0;
+}
+
+/*!
+    @brief  Find a glyph in the cache, rasterizing it into a slot on a
+            miss (through the regular GFX drawChar() with drawPixel()
+            redirected into the slot). A full pool recycles slots
+            round-robin.
+    @param  c
+            Character code, at the current textsize_x/textsize_y.
+    @return Page-format cell data, or NULL if rasterization cannot run.
+*/
+const uint8_t *Adafruit_SH110X::_cacheGlyph(uint8_t c) {
+  // linear probe -- the pool is small and a scan is cheap next to the
+  // per-pixel rendering it replaces
+  for (uint8_t i = 0; i < _glyph_slots; i++) {
+    GlyphSlot &s = _glyph_pool[i];
+    if (s.used && (s.code == c) && (s.sx == textsize_x) &&
+        (s.sy == textsize_y)) {
+      return s.data;
+    }
+  }
+
+  GlyphSlot *slot = NULL;
+  for (uint8_t i = 0; i < _glyph_slots; i++) {
+    if (!_glyph_pool[i].used) {
+      slot = &_glyph_pool[i];
+      break;
+    }
+  }
+  if (!slot) {
+    slot = &_glyph_pool[_glyph_victim];
+    _glyph_victim = (_glyph_victim + 1) % _glyph_slots;
+  }
+
+  slot->code = c;
+  slot->sx = textsize_x;
+  slot->sy = textsize_y;
+  slot->used = 1;
+  memset(slot->data, 0, sizeof(slot->data));
+
+  _cap_buf = slot->data;
+  _cap_w = textsize_x * 6;
+  _cap_h = textsize_y * 8;
+  _glyph_capture = true;
+  // bg == color keeps drawChar() from painting background pixels; the
+  // zeroed slot already is the background
+  Adafruit_GFX::drawChar(0, 0, c, 1, 1, textsize_x, textsize_y);
+  _glyph_capture = false;
+  return slot->data;
+}
+
+/*!
+    @brief  Blit a cached glyph cell into the framebuffer at (x, y) with
+            the current textcolor/textbgcolor semantics (opaque when they
+            differ, transparent when equal), splitting bytes across two
+            pages when y is unaligned.
+*/
+void Adafruit_SH110X::_blitGlyph(const uint8_t *g, int16_t x, int16_t y,
+                                 uint8_t w, uint8_t h) {
+  int16_t x0 = max(x, (int16_t)0);
+  int16_t x1 = min((int16_t)(x + w), WIDTH); // exclusive
+  if (x0 >= x1) {
+    return;
+  }
+  uint8_t fg = textcolor & 1;
+  uint8_t bg = textbgcolor & 1;
+  bool opaque = (textcolor != textbgcolor);
+  uint8_t pages = ((HEIGHT + 7) / 8);
+
+  for (uint8_t sp = 0; sp < h / 8; sp++) {
+    int16_t yy = y + sp * 8;
+    int16_t p0 = yy >> 3;   // floor, also for negative yy
+    uint8_t shift = yy & 7; // cell offset within the page
+    const uint8_t *src = g + (uint16_t)sp * w + (x0 - x);
+    for (uint8_t half = 0; half < 2; half++) {
+      int16_t p = p0 + half;
+      if ((half == 1) && !shift) {
+        break; // page aligned, no spill into the next page
+      }
+      if ((p < 0) || (p >= pages)) {
+        continue;
+      }
+      // this source page's bits and coverage mask within dest page p
+      uint8_t mask = half ? (uint8_t)(0xFF >> (8 - shift))
+                          : (uint8_t)(0xFF << shift);
+      uint8_t *dst = buffer + (uint16_t)p * (uint16_t)WIDTH;
+      for (int16_t i = x0; i < x1; i++) {
+        uint8_t val = half ? (uint8_t)(src[i - x0] >> (8 - shift))
+                           : (uint8_t)(src[i - x0] << shift);
+        if (opaque) {
+          uint8_t cell = (fg ? val : 0) | (bg ? (uint8_t)(mask & ~val) : 0);
+          dst[i] = (uint8_t)((dst[i] & ~mask) | cell);
+        } else if (fg) {
+          dst[i] |= val;
+        } else {
+          dst[i] &= (uint8_t)~val;
+        }
+      }
+      _markDirty((uint8_t)p, (uint8_t)x0, (uint8_t)(x1 - 1));
+      window_y1 = min(window_y1, (int16_t)(p * 8));
+      window_y2 = max(window_y2, (int16_t)(p * 8 + 7));
+    }
+  }
+  window_x1 = min(window_x1, x0);
+  window_x2 = max(window_x2, (int16_t)(x1 - 1));
+}
+
+/*!
+    @brief  Print-path character sink; services classic-font text from
+            the glyph cache when one is enabled, byte-blitting the cell
+            instead of re-rasterizing per pixel. Newline/wrap/cursor
+            behavior matches the GFX classic-font path, and anything the
+            cache does not cover (custom fonts, scale > 2, rotation,
+            SH110X_INVERSE text colors, streaming mode) falls straight
+            through to it.
+    @param  c
+            Character to render at the text cursor.
+    @return Number of characters written (1).
+*/
+size_t Adafruit_SH110X::write(uint8_t c) {
+  if (!_glyph_pool || gfxFont || (getRotation() != 0) || !buffer ||
+      (textsize_x > 2) || (textsize_y > 2) || (textcolor > 1) ||
+      (textbgcolor > 1)) {
+    // INVERSE colors XOR per pixel in the GFX path; the byte blit has
+    // no XOR mode, so let GFX handle them
+    return Adafruit_GFX::write(c);
+  }
+  uint8_t cw = textsize_x * 6;
+  uint8_t ch = textsize_y * 8;
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += ch;
+    return 1;
+  }
+  if (c == '\r') {
+    return 1;
+  }
+  if (wrap && ((cursor_x + cw) > _width)) {
+    cursor_x = 0;
+    cursor_y += ch;
+  }
+  const uint8_t *g = _cacheGlyph(c);
+  if (!g) {
+    return Adafruit_GFX::write(c);
+  }
+  _blitGlyph(g, cursor_x, cursor_y, cw, ch);
+  cursor_x += cw;
+  return 1;
+}
+
+// DELTA STREAM -------------------------------------------------------------
+
+/*!
+    @brief  Encode the framebuffer changes since the last capture as a
+            compact stream of (page, column offset, run length, bytes...)
+            records -- the same page/span diffing the display path uses,
+            but against a private reference frame, so capturing is
+            independent of the panel refresh. Meant for mirroring device
+            screens over a telemetry link: send the delta instead of the
+            raw 1 KB buffer, replay it remotely with applyDelta().
+
+            The first call allocates the reference frame (zeroed, i.e.
+            "receiver starts from a cleared buffer") and therefore emits
+            the full visible content. If the output buffer fills up,
+            the records already written are returned and the remaining
+            changes are simply picked up by the next capture.
+    @param  out
+            Destination for the encoded records.
+    @param  max
+            Capacity of out in bytes.
+    @return Number of bytes written; 0 when nothing changed (or no
+            framebuffer / no memory for the reference frame).
+*/
+size_t Adafruit_SH110X::captureDelta(uint8_t *out, size_t max) {
+  if (!buffer || !out) {
+    return 0;
+  }
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  if (!_delta_ref) {
+    _delta_ref = (uint8_t *)malloc((uint16_t)WIDTH * pages);
+    if (!_delta_ref) {
+      return 0;
+    }
+    memset(_delta_ref, 0, (uint16_t)WIDTH * pages);
+  }
+
+  size_t used = 0;
+  for (uint8_t p = 0; p < pages; p++) {
+    const uint8_t *live = buffer + (uint16_t)p * (uint16_t)WIDTH;
+    uint8_t *ref = _delta_ref + (uint16_t)p * (uint16_t)WIDTH;
+    uint8_t c = 0;
+    while (c < WIDTH) {
+      if (live[c] == ref[c]) {
+        c++;
+        continue;
+      }
+      // extend the run, absorbing gaps of up to two unchanged bytes --
+      // cheaper than paying another 3-byte record header
+      uint8_t start = c;
+      uint8_t last_diff = c;
+      for (uint8_t j = c + 1; (j < WIDTH) && (j - last_diff <= 2); j++) {
+        if (live[j] != ref[j]) {
+          last_diff = j;
+        }
+      }
+      uint8_t run = last_diff - start + 1;
+      if (used + 3 + run > max) {
+        // out is full: emit as much of this run as fits (the remainder,
+        // and any later spans, go in the next capture)
+        if ((max - used) <= 3) {
+          return used;
+        }
+        run = (uint8_t)(max - used - 3);
+      }
+      out[used++] = p;
+      out[used++] = start;
+      out[used++] = run;
+      memcpy(out + used, live + start, run);
+      used += run;
+      memcpy(ref + start, live + start, run); // this span is now reported
+      c = last_diff + 1;
+    }
+  }
+  return used;
+}
+
+/*!
+    @brief  Replay a captureDelta() stream into this display's
+            framebuffer, marking the touched spans dirty so the next
+            display() pushes them to the panel.
+    @param  delta
+            Encoded records from captureDelta().
+    @param  len
+            Length of the stream in bytes.
+    @return true if the whole stream parsed and applied cleanly, false
+            on a malformed or truncated record (the framebuffer may then
+            be partially updated).
+*/
+bool Adafruit_SH110X::applyDelta(const uint8_t *delta, size_t len) {
+  if (!buffer || !delta) {
+    return false;
+  }
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  size_t pos = 0;
+  while (pos < len) {
+    if (len - pos < 3) {
+      return false; // truncated header
+    }
+    uint8_t page = delta[pos];
+    uint8_t off = delta[pos + 1];
+    uint8_t run = delta[pos + 2];
+    pos += 3;
+    if ((page >= pages) || !run || ((uint16_t)off + run > WIDTH) ||
+        (len - pos < run)) {
+      return false; // malformed record
+    }
+    memcpy(buffer + (uint16_t)page * (uint16_t)WIDTH + off, delta + pos, run);
+    pos += run;
+    _markDirty(page, off, (uint8_t)(off + run - 1));
+    window_x1 = min(window_x1, (int16_t)off);
+    window_x2 = max(window_x2, (int16_t)(off + run - 1));
+    window_y1 = min(window_y1, (int16_t)(page * 8));
+    window_y2 = max(window_y2, (int16_t)(page * 8 + 7));
+  }
+  return true;
+}
+
+// POWER MANAGEMENT ---------------------------------------------------------
+
+/*!
+    @brief  Put the panel to sleep: display off, and the internal DC-DC
+            charge pump disabled if the init sequence had enabled it.
+            The SH110X retains its display RAM in this state, and the
+            MCU-side framebuffer and dirty tracking are left untouched --
+            so a later wake() is two-ish command bytes and shows the old
+            image immediately, with no reinitialization and no
+            full-frame retransfer.
+    @return true if the commands were acknowledged, false on bus failure.
+*/
+bool Adafruit_SH110X::sleep(void) {
+  if (_sleeping) {
+    return true;
+  }
+  if (!oled_command(SH110X_DISPLAYOFF)) {
+    return false;
+  }
+  if (_dcdc_mode != 0x8A) {
+    // pump control is only accepted while the display is off
+    const uint8_t pump_off[] = {SH110X_DCDC, 0x8A};
+    if (!oled_commandList(pump_off, sizeof(pump_off))) {
+      return false;
+    }
+  }
+  _sleeping = true;
+  return true;
+}
+
+/*!
+    @brief  Wake the panel from sleep(): re-enable the charge pump (if
+            the init sequence used it), restore the last contrast level
+            and turn the display back on. The retained panel RAM becomes
+            visible immediately; nothing is retransferred. The brief
+            pump settle reuses the setFastBootDelay() interval.
+    @return true if the commands were acknowledged, false on bus failure.
+*/
+bool Adafruit_SH110X::wake(void) {
+  if (!_sleeping) {
+    return true;
+  }
+  if (_dcdc_mode != 0x8A) {
+    const uint8_t pump_on[] = {SH110X_DCDC, _dcdc_mode};
+    if (!oled_commandList(pump_on, sizeof(pump_on))) {
+      return false;
+    }
+    delay(_fast_boot_delay_ms); // let the pump come up before display on
+  }
+  const uint8_t on[] = {SH110X_SETCONTRAST, _contrast, SH110X_DISPLAYON};
+  if (!oled_commandList(on, sizeof(on))) {
+    return false;
+  }
+  _sleeping = false;
+  return true;
+}
+
+/*!
+    @brief  Check whether the panel is currently in the sleep() state.
+    @return true between a successful sleep() and the next wake().
+*/
+bool Adafruit_SH110X::sleeping(void) { return _sleeping; }
+
+/*!
+    @brief  Set the display contrast and remember the level so wake()
+            can restore it after a sleep() cycle.
+    @param  level
+            Contrast/brightness, 0x00 (dimmest) to 0xFF.
+*/
+void Adafruit_SH110X::setContrast(uint8_t level) {
+  _contrast = level;
+  _fade_active = false; // an explicit set supersedes a running ramp
+  _dimmed = false;
+  Adafruit_GrayOLED::setContrast(level);
+}
+
+// CONTRAST EFFECTS ---------------------------------------------------------
+
+/*!
+    @brief  Ramp the hardware contrast register to a new level over a
+            given time, without touching the framebuffer -- each step is
+            a two-byte SH110X_SETCONTRAST command instead of a repainted
+            full frame. The ramp is advanced from displayIfDirty(), so
+            applications already running the frame governor loop get the
+            fade for free; poll fadeActive() to know when it lands.
+    @param  level
+            Target contrast, 0x00 (dimmest) to 0xFF.
+    @param  ms
+            Ramp duration in milliseconds; 0 sets the level immediately.
+*/
+void Adafruit_SH110X::fadeTo(uint8_t level, uint16_t ms) {
+  if (ms == 0) {
+    setContrast(level);
+    return;
+  }
+  _fade_from = _dimmed ? 0x00 : _contrast;
+  _fade_target = level;
+  _fade_last_sent = _fade_from;
+  _fade_ms = ms;
+  _fade_start_ms = millis();
+  _fade_active = true;
+  _dimmed = false;
+}
+
+/*!
+    @brief  Check whether a fadeTo() ramp is still running.
+    @return true until the ramp reaches its target level.
+*/
+bool Adafruit_SH110X::fadeActive(void) { return _fade_active; }
+
+/*!
+    @brief  Advance a running fadeTo() ramp: interpolate the contrast
+            for the elapsed time and transmit it only when the level
+            actually changed.
+*/
+void Adafruit_SH110X::_fadeTick(void) {
+  if (!_fade_active) {
+    return;
+  }
+  uint32_t elapsed = millis() - _fade_start_ms;
+  uint8_t level;
+  if (elapsed >= _fade_ms) {
+    level = _fade_target;
+    _fade_active = false;
+    _contrast = level; // final level sticks (wake() restores it too)
+  } else {
+    level = (uint8_t)(_fade_from +
+                      ((int16_t)_fade_target - (int16_t)_fade_from) *
+                          (int32_t)elapsed / _fade_ms);
+    if (level == _fade_last_sent) {
+      return;
+    }
+  }
+  _fade_last_sent = level;
+  const uint8_t cmd[] = {SH110X_SETCONTRAST, level};
+  oled_commandList(cmd, sizeof(cmd));
+}
+
+/*!
+    @brief  Dim the panel to minimum brightness (or restore the last
+            contrast level) in hardware -- the inactivity-timeout dim
+            costs two command bytes instead of a masked repaint and a
+            full-frame push. The remembered contrast is not changed, so
+            setDim(false) returns exactly to the previous brightness.
+    @param  dim
+            true to dim, false to restore.
+*/
+void Adafruit_SH110X::setDim(bool dim) {
+  if (dim == _dimmed) {
+    return;
+  }
+  _fade_active = false;
+  _dimmed = dim;
+  const uint8_t cmd[] = {SH110X_SETCONTRAST,
+                         (uint8_t)(dim ? 0x00 : _contrast)};
+  oled_commandList(cmd, sizeof(cmd));
+}
+
+/*!
+    @brief  Invert the panel in hardware (SH110X_INVERTDISPLAY /
+            SH110X_NORMALDISPLAY) -- a one-byte command, no framebuffer
+            traffic, unlike repainting with inverted pixels. Useful for
+            flash/alert effects; pairs with invertRegion() when only an
+            area should flip.
+    @param  i
+            true for inverse video, false for normal.
+*/
+void Adafruit_SH110X::invert(bool i) {
+  oled_command(i ? SH110X_INVERTDISPLAY : SH110X_NORMALDISPLAY);
+}
+
+// ADAPTIVE I2C CLOCK -------------------------------------------------------
+
+/*!
+    @brief  Probe how fast this particular panel's I2C link really is and
+            lock the in-library clock (i2c_preclk) to the fastest reliable
+            rate. Each candidate is verified with a few ACK-checked
+            command writes at that speed; the surviving ladder is kept so
+            the transfer path can automatically downshift one step if bus
+            errors show up at runtime (marginal pull-ups, EMI, long
+            wires). Call once after begin().
+    @param  candidates
+            Clock rates in Hz, fastest first, or NULL for the built-in
+            list (1 MHz, 800 kHz, 400 kHz, 100 kHz).
+    @param  count
+            Entries in candidates (at most 6 are used).
+    @return The locked-in clock rate in Hz, or 0 on an SPI display (SPI
+            rate is fixed by the constructor) or if no candidate passed.
+*/
+uint32_t Adafruit_SH110X::probeMaxClock(const uint32_t *candidates,
+                                        uint8_t count) {
+  static const uint32_t defaults[] = {1000000, 800000, 400000, 100000};
+  if (!i2c_dev) {
+    return 0;
+  }
+  if (!candidates) {
+    candidates = defaults;
+    count = sizeof(defaults) / sizeof(defaults[0]);
+  }
+  if (count > SH110X_MAX_CLOCK_STEPS) {
+    count = SH110X_MAX_CLOCK_STEPS;
+  }
+
+  uint32_t locked = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    i2c_dev->setSpeed(candidates[i]);
+    // a few ACK-checked writes of a benign command (normal display mode)
+    bool ok = true;
+    for (uint8_t t = 0; t < 3; t++) {
+      if (!oled_command(SH110X_DISPLAYALLON_RESUME)) {
+        ok = false;
+        break;
+      }
+    }
+    if (ok) {
+      // keep this and every slower candidate as the fallback ladder
+      _probed_count = 0;
+      for (uint8_t j = i; (j < count) && (_probed_count < SH110X_MAX_CLOCK_STEPS);
+           j++) {
+        _probed_clocks[_probed_count++] = candidates[j];
+      }
+      _probed_index = 0;
+      locked = candidates[i];
+      i2c_preclk = locked;
+      break;
+    }
+  }
+
+  i2c_dev->setSpeed(i2c_postclk);
+  _bus_error_count = 0;
+  return locked;
+}
+
+/*!
+    @brief  Note a failed page transfer; after a few consecutive failures
+            the I2C clock downshifts one step on the ladder established by
+            probeMaxClock() (no-op if probing was never run or the bottom
+            step is already in use).
+*/
+void Adafruit_SH110X::_busError(void) {
+  if (++_bus_error_count < 3) {
+    return;
+  }
+  _bus_error_count = 0;
+  if ((_probed_count > 0) && (_probed_index + 1 < _probed_count)) {
+    _probed_index++;
+    i2c_preclk = _probed_clocks[_probed_index];
+  }
+}
+
+// FRAME PACING -------------------------------------------------------------
+
+/*!
+    @brief  Check whether any framebuffer content is waiting to be pushed
+            to the panel.
+    @return true if at least one page has a dirty span.
+*/
+bool Adafruit_SH110X::_anyDirty(void) {
+  for (uint8_t p = 0; p < SH110X_MAX_PAGES; p++) {
+    if (_page_dirty_x1[p] <= _page_dirty_x2[p]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+    @brief  Cap the rate at which displayIfDirty() pushes frames, so busy
+            screens degrade predictably instead of saturating the bus.
+    @param  hz
+            Maximum frames per second, or 0 to remove the cap.
+*/
+void Adafruit_SH110X::setMaxFrameRate(uint16_t hz) {
+  _min_frame_us = hz ? (1000000UL / hz) : 0;
+}
+
+/*!
+    @brief  Check whether a frame is waiting to go out: dirty content
+            exists (streaming mode counts as always dirty, there is no
+            damage tracking without a framebuffer).
+    @return true if the next displayIfDirty() call has work to do.
+*/
+bool Adafruit_SH110X::framePending(void) {
+  return _page_source ? true : _anyDirty();
+}
+
+/*!
+    @brief  Push a frame only if something changed and the frame-rate cap
+            allows it. Unlike display(), a fully clean screen costs zero
+            bus traffic -- no page command preambles are sent.
+    @return true if a frame was pushed, false if the screen was clean or
+            the pacing interval has not elapsed yet (call again later).
+*/
+bool Adafruit_SH110X::displayIfDirty(void) {
+  _fadeTick(); // advance any contrast ramp from the same pacing loop
+  if (!framePending()) {
+    return false;
+  }
+  if (_min_frame_us && ((micros() - _last_frame_us) < _min_frame_us)) {
+    return false; // too soon, keep accumulating damage
+  }
+  display();
+  return true;
+}
+
+// SCAN-SYNCHRONIZED REFRESH ------------------------------------------------
+
+/*!
+    @brief  Enable or disable the modeled-scan refresh used by
+            displaySynced(). The SH110X has no vsync/tear output, so the
+            beam position is modeled instead: a frame period (from the
+            programmed clock divider, or measured by the caller) plus a
+            micros() anchor set by markScanOrigin(). The model drifts
+            with the panel's uncalibrated oscillator (datasheet spread is
+            tens of percent), so re-anchor periodically, or pass a
+            measured period here for a slower drift.
+    @param  enable
+            true to arm the model, false to make displaySynced() behave
+            exactly like display().
+    @param  frame_us
+            Measured frame period in microseconds, or 0 to estimate one
+            from the last SETDISPLAYCLOCKDIV value and the panel height.
+*/
+void Adafruit_SH110X::setScanSync(bool enable, uint32_t frame_us) {
+  _scan_frame_us = enable ? (frame_us ? frame_us : _estimateFramePeriod()) : 0;
+  _scan_origin_us = micros();
+}
+
+/*!
+    @brief  Re-anchor the scan model: declares "a frame starts now".
+            Natural call sites are immediately after begin() (the hard
+            reset restarts the scan) and periodically thereafter to
+            counter oscillator drift.
+*/
+void Adafruit_SH110X::markScanOrigin(void) { _scan_origin_us = micros(); }
+
+/*!
+    @brief  The framebuffer row the modeled beam is currently reading
+            out, in RAM coordinates (display-start-line offset from
+            scrollVertical() is folded in).
+    @return Row 0..HEIGHT-1, or 0 if the scan model is not armed.
+*/
+uint16_t Adafruit_SH110X::scanLine(void) {
+  if (!_scan_frame_us) {
+    return 0;
+  }
+  uint32_t pos_us = (micros() - _scan_origin_us) % _scan_frame_us;
+  uint16_t com = (uint32_t)HEIGHT * pos_us / _scan_frame_us;
+  return (com + _display_start_line) % HEIGHT;
+}
+
+/*!
+    @brief  Push the dirty spans like display(), but order the page
+            writes to chase the modeled beam: each page is transmitted
+            right after the beam has read past it, so the readout always
+            sees either the complete old page or the complete new one --
+            no horizontal shear line through half-updated content.
+            Falls back to a plain display() when the model is not armed
+            (setScanSync()), in streaming mode, or in shadow-delta mode
+            (whose spans are computed inside display() itself). The
+            vertical-addressing burst is likewise skipped here: one long
+            frame transfer cannot be reordered against the beam.
+    @note   Waits (bounded by roughly one page-scan time) only when the
+            sole remaining dirty page is under the beam; a guard of two
+            modeled frame periods keeps a stale model from spinning.
+*/
+void Adafruit_SH110X::displaySynced(void) {
+  if (!_scan_frame_us || !buffer || _page_source ||
+      (_shadow && _shadow_valid)) {
+    display();
+    return;
+  }
+#ifdef SH110X_PROFILE
+  uint32_t frame_start = micros();
+#endif
+  _async_active = false;
+  yield();
+
+  uint8_t pages = ((HEIGHT + 7) / 8);
+  uint16_t pending = 0;
+  for (uint8_t p = 0; p < pages; p++) {
+    if (_page_dirty_x1[p] <= _page_dirty_x2[p]) {
+      pending |= (uint16_t)1 << p;
+    }
+#ifdef SH110X_PROFILE
+    else {
+      _stats.pages_skipped++;
+    }
+#endif
+  }
+
+  _spiFrameBegin();
+  uint32_t guard = micros();
+  while (pending) {
+    uint8_t bp = scanLine() / 8; // page under the beam
+    // prefer the page the beam most recently left: it has the longest
+    // time before the readout returns to it
+    int8_t pick = -1;
+    for (uint8_t k = 1; k < pages; k++) {
+      uint8_t p = (bp + pages - k) % pages;
+      if (pending & ((uint16_t)1 << p)) {
+        pick = (int8_t)p;
+        break;
+      }
+    }
+    if (pick < 0) {
+      // only the page under the beam is left; let the beam move on
+      if ((micros() - guard) > (2 * _scan_frame_us)) {
+        pick = (int8_t)bp; // model must be off; don't spin forever
+      } else {
+        yield();
+        continue;
+      }
+    }
+    if (_sendPageRetried(pick, _page_dirty_x1[pick], _page_dirty_x2[pick])) {
+      _page_dirty_x1[pick] = 0xFF; // delivered, page is clean again
+      _page_dirty_x2[pick] = 0;
+    }
+    if (_transport) {
+      _transport->flush(); // the send must hit the bus now, not at frame
+                           // end, or the beam scheduling means nothing
+    }
+    // a failed page keeps its span standing for the next refresh
+    pending &= ~((uint16_t)1 << pick);
+  }
+  _spiFrameEnd();
+
+  // reset dirty window
+  window_x1 = 1024;
+  window_y1 = 1024;
+  window_x2 = -1;
+  window_y2 = -1;
+
+  _last_frame_us = micros();
+#ifdef SH110X_PROFILE
+  _profileFrame(frame_start);
+#endif
+}
+
+/*!
+    @brief  Reprogram the display clock divider/oscillator trim register
+            (SH110X_SETDISPLAYCLOCKDIV) and fold the new value into the
+            scan model. Lower divide ratios raise the refresh rate
+            (better motion, more supply ripple); higher ratios lower it
+            (less power). The panel keeps scanning throughout, so this
+            is safe to call with the display on.
+    @param  value
+            Raw register byte: low nibble is divide ratio minus one,
+            high nibble trims the internal oscillator in ~5% steps
+            around its center value of 5. The init sequences program
+            0x80 (SH1106G) / 0x51 (SH1107).
+    @return true if the command was acknowledged.
+*/
+bool Adafruit_SH110X::setDisplayClockDiv(uint8_t value) {
+  uint8_t cmd[] = {SH110X_SETDISPLAYCLOCKDIV, value};
+  if (!oled_commandList(cmd, sizeof(cmd))) {
+    return false;
+  }
+  _clock_div = value;
+  if (_scan_frame_us) {
+    // retuning shifts the frame phase anyway; re-estimate and re-anchor
+    _scan_frame_us = _estimateFramePeriod();
+    _scan_origin_us = micros();
+  }
+  return true;
+}
+
+/*!
+    @brief  Nominal frame period from the programmed clock divider:
+            HEIGHT rows, ~54 display clocks per row (precharge +
+            discharge + hold), divide ratio from the low nibble, against
+            a ~540 kHz internal oscillator trimmed ~5% per high-nibble
+            step around its center value of 5. The real oscillator
+            spread is wide (tens of percent part to part), so treat this
+            as a starting point and prefer a measured period via
+            setScanSync() when tear-freedom matters.
+*/
+uint32_t Adafruit_SH110X::_estimateFramePeriod(void) {
+  uint8_t divide = (_clock_div & 0x0F) + 1;
+  int32_t fosc_hz =
+      540000L * (100 + 5 * ((int8_t)(_clock_div >> 4) - 5)) / 100;
+  uint64_t period =
+      (uint64_t)HEIGHT * divide * 54 * 1000000ULL / (uint32_t)fosc_hz;
+  return (uint32_t)period;
+}
+
+/*!
+    @brief  Begin a non-blocking push of the dirty window to the display.
+            The first page is sent immediately; each subsequent call to
+            displayBusy() advances the transfer by one page, so the frame
+            push can be overlapped with application work. The Adafruit
+            BusIO transports used here have no portable DMA/interrupt
+            completion hooks, so the state machine is advanced by polling
+            rather than from an ISR.
+    @return true; a transfer is running (or nothing was dirty, in which
+            case it completes immediately at no bus cost).
+    @note   Drawing into the framebuffer while a transfer is in flight is
+            allowed but the on-glass result may mix old and new content
+            until the next display call.
+*/
+bool Adafruit_SH110X::displayAsync(void) {
+  if (_async_active) {
+    return true; // a frame is already on its way out
+  }
+
+  if (_page_source) {
+    display(); // streaming mode has no dirty state to resume over
+    return true;
+  }
+
+  yield();
+
+  _asyncCapture();
+  displayBusy(); // push the first page out right away
+  return true;
+}
+
+/*!
+    @brief  Snapshot the per-page dirty spans into the async/step state
+            machine and reset the live dirty tracking, so the framebuffer
+            can start accumulating the next frame's damage while this one
+            trickles out.
+*/
+void Adafruit_SH110X::_asyncCapture(void) {
+  memcpy(_async_x1, _page_dirty_x1, sizeof(_async_x1));
+  memcpy(_async_x2, _page_dirty_x2, sizeof(_async_x2));
+  _async_page = 0;
+  _async_last_page = ((HEIGHT + 7) / 8);
+
+  // reset dirty window
+  window_x1 = 1024;
+  window_y1 = 1024;
+  window_x2 = -1;
+  window_y2 = -1;
+  _resetDirtySpans();
+
+  _async_active = true;
+}
+
+/*!
+    @brief  Count the dirty pages the in-flight frame still has to send.
+    @return Pending page count, 0 when idle or complete.
+*/
+uint8_t Adafruit_SH110X::_asyncPagesRemaining(void) {
+  if (!_async_active) {
+    return 0;
+  }
+  if (_page_source) {
+    return _async_last_page - _async_page;
+  }
+  uint8_t remaining = 0;
+  for (uint8_t p = _async_page; p < _async_last_page; p++) {
+    if (_async_x1[p] <= _async_x2[p]) {
+      remaining++;
+    }
+  }
+  return remaining;
+}
+
+/*!
+    @brief  Resumable, bounded-latency variant of display() for RTOS and
+            tight-loop integration: each call transmits at most one dirty
+            page and returns, so a low-priority task can trickle a frame
+            out between hard deadlines. The first call of a frame
+            snapshots the dirty state (further drawing accumulates into
+            the next frame); the completion callback registered with
+            onDisplayComplete() fires after the final page.
+    @return Number of pages still pending after this step; 0 means the
+            frame is complete (or there was nothing dirty to send).
+*/
+uint8_t Adafruit_SH110X::displayStep(void) {
+  if (_page_source) {
+    // streaming mode: generate and push one page per call
+    uint8_t scratch[132]; // widest SH110X column RAM
+    if ((uint8_t)WIDTH > sizeof(scratch)) {
+      return 0;
+    }
+    if (!_async_active) {
+      _async_page = 0;
+      _async_last_page = ((HEIGHT + 7) / 8);
+      _async_active = true;
+    }
+    _page_source(_async_page, scratch, _page_source_arg);
+    _sendPageBufRetried(scratch, _async_page, 0, WIDTH - 1);
+    _async_page++;
+    if (_async_page >= _async_last_page) {
+      _async_active = false;
+      if (_display_done_cb) {
+        _display_done_cb(_display_done_arg);
+      }
+      return 0;
+    }
+    return _async_last_page - _async_page;
+  }
+
+  if (!_async_active) {
+    if (!_anyDirty()) {
+      return 0; // nothing to do
+    }
+    _asyncCapture();
+  }
+  displayBusy(); // sends one dirty page, fires the callback when done
+  return _asyncPagesRemaining();
+}
+
+/*!
+    @brief  Poll (and advance) an asynchronous display transfer started
+            with displayAsync(). Each call sends at most one (dirty) page.
+    @return true while the transfer is still in progress, false once the
+            whole frame has been pushed (or no transfer was running).
+*/
+bool Adafruit_SH110X::displayBusy(void) {
+  if (!_async_active) {
+    return false;
+  }
+
+  // skip clean pages entirely
+  while ((_async_page < _async_last_page) &&
+         (_async_x1[_async_page] > _async_x2[_async_page])) {
+    _async_page++;
+  }
+
+  if (_async_page < _async_last_page) {
+    if (!_sendPageRetried(_async_page, _async_x1[_async_page],
+                          _async_x2[_async_page])) {
+      // hand the missed region back to the dirty state so the next frame
+      // resends it; the async frame itself keeps advancing
+      _markDirty(_async_page, _async_x1[_async_page], _async_x2[_async_page]);
+    }
+    _async_page++;
+  }
+
+  // report completion promptly if only clean pages remain
+  while ((_async_page < _async_last_page) &&
+         (_async_x1[_async_page] > _async_x2[_async_page])) {
+    _async_page++;
+  }
+
+  if (_async_page >= _async_last_page) {
+    _async_active = false;
+    if (_display_done_cb) {
+      _display_done_cb(_display_done_arg);
+    }
+    return false;
+  }
+  return true;
+}
+
+/*!
+    @brief  Register a callback invoked when an asynchronous display
+            transfer completes.
+    @param  callback
+            Function called (from the displayBusy() polling context) after
+            the final page of an async frame has been sent, or NULL to
+            remove a previously registered callback.
+    @param  user_data
+            Opaque pointer handed back to the callback.
+*/
+void Adafruit_SH110X::onDisplayComplete(void (*callback)(void *),
+                                        void *user_data) {
+  _display_done_cb = callback;
+  _display_done_arg = user_data;
 }
@@ -34,8 +34,17 @@
 // Uncomment to disable Adafruit splash logo
 // #define SH110X_NO_SPLASH
 
+// Uncomment (or define on the compiler command line) to compile in the
+// frame-timing instrumentation -- see getFrameStats(). Costs a micros()
+// read around each bus write, so it is off by default.
+// #define SH110X_PROFILE
+
 #define SH110X_MEMORYMODE 0x20          ///< See datasheet
 #define SH110X_COLUMNADDR 0x21          ///< See datasheet
+#define SH110X_MEMORYMODE_VERTICAL                                             \
+  0x21 ///< SH1107 only: vertical addressing (page auto-increments per data
+       ///< byte, column advances on wrap) -- same opcode the SSD1306 uses
+       ///< for COLUMNADDR
 #define SH110X_PAGEADDR 0x22            ///< See datasheet
 #define SH110X_SETCONTRAST 0x81         ///< See datasheet
 #define SH110X_CHARGEPUMP 0x8D          ///< See datasheet
@@ -66,11 +75,165 @@
 #define SH110X_SETHIGHCOLUMN 0x10 ///< Not currently used
 #define SH110X_SETSTARTLINE 0x40  ///< See datasheet
 
+/*!
+    @brief  Page-generator callback for buffer-less streaming mode: fill
+            dst with one page (8 rows) of vertical-byte display data.
+    @param  page       Page index being requested (0 = top 8 rows).
+    @param  dst        Destination, one byte per column, WIDTH bytes.
+    @param  user_data  Opaque pointer passed to setPageSource().
+*/
+typedef void (*SH110X_PageSource)(uint8_t page, uint8_t *dst, void *user_data);
+
+#ifdef SH110X_PROFILE
+/*!
+    @brief  Frame statistics collected when the library is built with
+            SH110X_PROFILE. Counters are cumulative since the last
+            resetFrameStats(); derive averages as total / frames.
+*/
+typedef struct {
+  uint32_t frames;        ///< display calls measured
+  uint32_t last_us;       ///< duration of the most recent frame
+  uint32_t min_us;        ///< shortest frame seen
+  uint32_t max_us;        ///< longest frame seen
+  uint32_t total_us;      ///< summed frame time (avg = total_us / frames)
+  uint32_t cmd_us;        ///< time spent in command-only bus writes
+  uint32_t data_us;       ///< time spent in data-carrying bus writes
+  uint32_t cmd_bytes;     ///< addressing/control bytes transmitted
+  uint32_t data_bytes;    ///< framebuffer bytes transmitted
+  uint32_t pages_sent;    ///< pages (or partial pages) pushed to the panel
+  uint32_t pages_skipped; ///< pages skipped as clean by dirty tracking
+  uint32_t retries;       ///< transfer retries after bus errors
+} SH110X_FrameStats;
+#endif // SH110X_PROFILE
+
+#define SH110X_TRANSPORT_MAX_OPS 36 ///< queue depth of the stock transports
+#define SH110X_TRANSPORT_CMD_MAX 8  ///< longest queueable command sequence
+
+/*!
+    @brief  Pluggable frame-transfer backend, installed with
+            Adafruit_SH110X::setTransport(). The refresh routines queue a
+            frame as a sequence of command bursts (page/column
+            addressing) and data runs, then call flush() once, so a
+            platform backend (DMA chains, hardware command linking, async
+            drivers) can submit the whole frame in one go. Command bytes
+            are copied when queued; data pointers are handed over
+            zero-copy and the caller keeps them valid and unmodified
+            until flush() returns.
+*/
+class SH110X_Transport {
+public:
+  virtual ~SH110X_Transport() {}
+  /*!
+      @brief  Append a command burst (D/C low / control byte 0x00).
+      @param  cmds  Command bytes, copied before return.
+      @param  n     Number of bytes.
+      @return false if the queue is full (the caller leaves the affected
+              region dirty and retries next frame).
+  */
+  virtual bool queueCommand(const uint8_t *cmds, uint8_t n) = 0;
+  /*!
+      @brief  Append a display-data run (D/C high / control byte 0x40).
+      @param  data  Data bytes, NOT copied: caller-owned, must stay valid
+                    and unmodified until flush() returns.
+      @param  len   Number of bytes.
+      @return false if the queue is full.
+  */
+  virtual bool queueData(const uint8_t *data, uint16_t len) = 0;
+  /*!
+      @brief  Transmit everything queued, in order, and empty the queue.
+      @return true if the whole sequence went out.
+  */
+  virtual bool flush(void) = 0;
+};
+
+/*!
+    @brief  Shared queue bookkeeping for the stock transports: a fixed
+            table of command/data ops filled by the queue calls and
+            consumed by each backend's flush(). Roughly half a KB of RAM
+            per instance, which is why the transports are opt-in rather
+            than the default path.
+*/
+class SH110X_QueuedTransport : public SH110X_Transport {
+public:
+  bool queueCommand(const uint8_t *cmds, uint8_t n);
+  bool queueData(const uint8_t *data, uint16_t len);
+
+protected:
+  /*! One queued operation: either a copied command burst (cmd_len > 0)
+   * or a zero-copy data run */
+  struct Op {
+    const uint8_t *data;                  ///< data run start (caller-owned)
+    uint16_t len;                         ///< data run length
+    uint8_t cmd[SH110X_TRANSPORT_CMD_MAX]; ///< copied command bytes
+    uint8_t cmd_len;                      ///< 0 for data ops
+  };
+  Op _ops[SH110X_TRANSPORT_MAX_OPS]; ///< queued frame sequence
+  uint8_t _op_count = 0;             ///< ops queued so far
+};
+
+/*!
+    @brief  Stock I2C backend: replays the queue through an
+            Adafruit_I2CDevice with the usual 0x00/0x40 control-byte
+            framing, chunking data runs to the device's buffer size and
+            raising the bus clock for the replay as the built-in path
+            does. Functionally the same wire traffic as the built-in
+            path; exists as the reference implementation (and test
+            double) for platform-specific transports.
+*/
+class SH110X_I2CTransport : public SH110X_QueuedTransport {
+public:
+  /*!
+      @brief  Wrap an I2C device (normally the display's own).
+      @param  dev      Device to transmit through; must outlive the
+                       transport.
+      @param  preclk   Bus clock (Hz) while a flush is transmitting;
+                       pass the display's 'during' speed. Default
+                       400000.
+      @param  postclk  Bus clock (Hz) restored after the flush, for
+                       other devices sharing the bus. Default 100000.
+  */
+  SH110X_I2CTransport(Adafruit_I2CDevice *dev, uint32_t preclk = 400000,
+                      uint32_t postclk = 100000)
+      : _dev(dev), _preclk(preclk), _postclk(postclk) {}
+  bool flush(void);
+
+private:
+  Adafruit_I2CDevice *_dev; ///< transmission device
+  uint32_t _preclk;         ///< bus clock during a flush
+  uint32_t _postclk;        ///< bus clock between flushes
+};
+
+/*!
+    @brief  Stock SPI backend: replays the queue inside one CS-asserted
+            transaction, toggling D/C per op. Data runs go out with
+            per-byte transfers so the caller's buffer is never clobbered
+            in place.
+*/
+class SH110X_SPITransport : public SH110X_QueuedTransport {
+public:
+  /*!
+      @brief  Wrap an SPI device (normally the display's own).
+      @param  dev     Device to transmit through; must outlive the
+                      transport.
+      @param  dc_pin  Data/command pin (Arduino numbering).
+  */
+  SH110X_SPITransport(Adafruit_SPIDevice *dev, int16_t dc_pin)
+      : _dev(dev), _dc(dc_pin) {}
+  bool flush(void);
+
+private:
+  Adafruit_SPIDevice *_dev; ///< transmission device
+  int16_t _dc;              ///< data/command pin
+};
+
 /*!
     @brief  Class that stores state and functions for interacting with
             SH110X OLED displays. Not instantiatable - use a subclass!
 */
 class Adafruit_SH110X : public Adafruit_GrayOLED {
+  friend class SH110X_DisplayGroup; ///< interleaves transfers across panels
+  friend class SH110X_SpriteLayer;  ///< composites page-format sprites
+
 public:
   // NEW CONSTRUCTORS -- recommended for new projects
   Adafruit_SH110X(uint16_t w, uint16_t h, TwoWire *twi = &Wire,
@@ -85,13 +248,201 @@ public:
   virtual ~Adafruit_SH110X(void) = 0;
 
   void display(void);
+  bool displayAsync(void);
+  bool displayBusy(void);
+  uint8_t displayStep(void);
+  void onDisplayComplete(void (*callback)(void *), void *user_data = NULL);
+
+  bool setDoubleBuffer(bool enable);
+  void setPageSource(SH110X_PageSource source, void *user_data = NULL);
+  bool setBuffer(uint8_t *fb, size_t len);
+
+  void scrollVertical(int16_t lines);
+  uint8_t getStartLine(void);
+
+  void setMaxFrameRate(uint16_t hz);
+  bool framePending(void);
+  bool displayIfDirty(void);
+
+  bool setVerticalTransfers(bool enable);
+  void setTransport(SH110X_Transport *transport);
+
+  void setScanSync(bool enable, uint32_t frame_us = 0);
+  void markScanOrigin(void);
+  uint16_t scanLine(void);
+  void displaySynced(void);
+  bool setDisplayClockDiv(uint8_t value);
+
+  uint32_t probeMaxClock(const uint32_t *candidates = NULL, uint8_t count = 0);
+
+  void setFastBootDelay(uint8_t ms);
+
+  bool sleep(void);
+  bool wake(void);
+  bool sleeping(void);
+  void setContrast(uint8_t level);
+
+  void fadeTo(uint8_t level, uint16_t ms);
+  bool fadeActive(void);
+  void setDim(bool dim);
+  void invert(bool i);
+
+  size_t captureDelta(uint8_t *out, size_t max);
+  bool applyDelta(const uint8_t *delta, size_t len);
+
+  bool enableGlyphCache(uint8_t slots = 64);
+  void disableGlyphCache(void);
+  using Adafruit_GrayOLED::write;
+  virtual size_t write(uint8_t c);
+
+#ifdef SH110X_PROFILE
+  SH110X_FrameStats getFrameStats(void);
+  void resetFrameStats(void);
+#endif
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void clearDisplay(void);
+  static void convertToPages(const uint8_t *src, uint16_t w, uint16_t h,
+                             uint8_t *dst);
+  bool drawBitmapFast(int16_t x, int16_t y, const uint8_t *data, uint8_t w,
+                      uint8_t h);
+  bool drawCompressedBitmap(int16_t x, int16_t y, const uint8_t *rle,
+                            uint16_t rle_len, uint8_t w, uint8_t h);
+  void fillPages(uint8_t first_page, uint8_t last_page, uint8_t pattern);
+  void clearDisplayFast(void);
+  void invertRegion(int16_t x, int16_t y, int16_t w, int16_t h);
 
 protected:
   /*! some displays are 'inset' in memory, so we have to skip some memory to
    * display */
   uint8_t _page_start_offset = 0;
 
+  /// Max page count across the SH110X family (128 rows / 8)
+  static const uint8_t SH110X_MAX_PAGES = 16;
+
+  /// Extra attempts for a page transfer that fails (NAK, bus glitch)
+  static const uint8_t SH110X_PAGE_RETRIES = 2;
+
+  bool _sendPage(uint8_t page, uint8_t col_start, uint8_t col_end);
+  bool _sendPageBuf(const uint8_t *page_data, uint8_t page, uint8_t col_start,
+                    uint8_t col_end);
+  bool _sendPageRetried(uint8_t page, uint8_t col_start, uint8_t col_end);
+  bool _sendPageBufRetried(const uint8_t *page_data, uint8_t page,
+                           uint8_t col_start, uint8_t col_end);
+  virtual bool oled_setStartLine(uint8_t line);
+
+  uint8_t _display_start_line = 0; ///< current display-start-line register
+  /*! true while a beginFast() runs: skip the splash and use the short
+   * power-on settle instead of the conservative 100 ms */
+  bool _fast_boot = false;
+  uint8_t _fast_boot_delay_ms = 2; ///< settle before DISPLAYON in fast boot
+
+  /*! DC-DC mode byte the init sequence programmed (0x8B = internal pump
+   * on, 0x8A = off/external); wake() restores it after sleep() */
+  uint8_t _dcdc_mode = 0x8A;
+  uint8_t _contrast = 0x7F;  ///< last contrast level, restored by wake()
+  uint8_t _clock_div = 0x51; ///< last SETDISPLAYCLOCKDIV value sent
+  bool _sleeping = false;    ///< true between sleep() and wake()
+  /*! false when the framebuffer was adopted via setBuffer() and must not
+   * be freed by this library */
+  bool _buffer_owned = true;
+  /*! true while a display group holds the I2C bus at the fast clock, so
+   * the per-page setSpeed() switching is skipped */
+  bool _i2c_speed_hold = false;
+  /*! true while display() holds one SPI transaction (CS asserted) across
+   * the whole frame, so page sends skip per-write transaction setup */
+  bool _spi_frame_hold = false;
+  /*! controller supports SH110X_MEMORYMODE_VERTICAL (SH1107 only; set by
+   * the subclass constructors) */
+  bool _vertical_ok = false;
+  bool _vertical_transfers = false; ///< vertical burst mode opted in
+  /*! true when the 0x20 restore after a vertical burst failed, so the
+   * panel's addressing mode must be reasserted before page-mode sends */
+  bool _vmode_untrusted = false;
+  /*! pluggable frame-transfer backend, NULL = built-in I2C/SPI path */
+  SH110X_Transport *_transport = NULL;
+  /*! true while a display call defers the transport flush() to frame
+   * end, batching the whole frame into one submission */
+  bool _transport_hold = false;
+  void _markDirty(uint8_t page, uint8_t x_min, uint8_t x_max);
+  void _markAllDirty(void);
+  void _resetDirtySpans(void);
+
+  /// Per-page first dirty column, 0xFF when the page is clean
+  uint8_t _page_dirty_x1[SH110X_MAX_PAGES];
+  /// Per-page last dirty column (inclusive)
+  uint8_t _page_dirty_x2[SH110X_MAX_PAGES];
+
 private:
+  SH110X_PageSource _page_source = NULL; ///< streaming-mode page generator
+  void *_page_source_arg = NULL;  ///< user argument for the page generator
+  uint8_t *_shadow = NULL;        ///< shadow framebuffer for delta detection
+  uint8_t *_delta_ref = NULL;     ///< captureDelta() reference frame
+  bool _shadow_valid = false;     ///< true once the shadow mirrors the panel
+  bool _async_active = false;     ///< true while an async frame is in flight
+  uint8_t _async_page = 0;        ///< next page the async state machine sends
+  uint8_t _async_last_page = 0;   ///< last page (exclusive) of the async frame
+  uint8_t _async_x1[SH110X_MAX_PAGES]; ///< async snapshot of the dirty spans
+  uint8_t _async_x2[SH110X_MAX_PAGES]; ///< async snapshot of the dirty spans
+  void (*_display_done_cb)(void *) = NULL; ///< completion callback, if any
+  void *_display_done_arg = NULL;          ///< user argument for the callback
+  uint32_t _min_frame_us = 0;  ///< frame pacing floor, 0 = unthrottled
+  uint32_t _last_frame_us = 0; ///< micros() timestamp of the last frame
+
+  bool _fade_active = false;      ///< a fadeTo() ramp is in progress
+  uint8_t _fade_from = 0;         ///< contrast the ramp started from
+  uint8_t _fade_target = 0;       ///< contrast the ramp ends at
+  uint8_t _fade_last_sent = 0;    ///< last level transmitted by the ramp
+  uint16_t _fade_ms = 0;          ///< ramp duration
+  uint32_t _fade_start_ms = 0;    ///< millis() when the ramp started
+  bool _dimmed = false;           ///< setDim(true) is in effect
+
+  void _fadeTick(void);
+
+  uint32_t _scan_frame_us = 0;  ///< modeled scan period, 0 = sync off
+  uint32_t _scan_origin_us = 0; ///< micros() of a modeled frame start
+
+  uint32_t _estimateFramePeriod(void);
+
+  /// One cached classic-font glyph cell in vertical-byte page format
+  struct GlyphSlot {
+    uint8_t code;     ///< character code
+    uint8_t sx;       ///< textsize_x it was rasterized at
+    uint8_t sy;       ///< textsize_y it was rasterized at
+    uint8_t used;     ///< slot holds a glyph
+    uint8_t data[24]; ///< 6*sx columns per page, sy pages (scale <= 2)
+  };
+  GlyphSlot *_glyph_pool = NULL; ///< glyph cache, NULL when disabled
+  uint8_t _glyph_slots = 0;      ///< pool capacity
+  uint8_t _glyph_victim = 0;     ///< round-robin replacement cursor
+  bool _glyph_capture = false;   ///< drawPixel() redirects to _cap_buf
+  uint8_t *_cap_buf = NULL;      ///< rasterization capture target
+  uint8_t _cap_w = 0;            ///< capture cell width in pixels
+  uint8_t _cap_h = 0;            ///< capture cell height in pixels
+
+  const uint8_t *_cacheGlyph(uint8_t c);
+  void _blitGlyph(const uint8_t *g, int16_t x, int16_t y, uint8_t w,
+                  uint8_t h);
+
+  bool _anyDirty(void);
+  bool _sendFrameVertical(void);
+  void _spiFrameBegin(void);
+  void _spiFrameEnd(void);
+  void _asyncCapture(void);
+  uint8_t _asyncPagesRemaining(void);
+  void _busError(void);
+
+  /// Max entries kept from a probeMaxClock() candidate list
+  static const uint8_t SH110X_MAX_CLOCK_STEPS = 6;
+  uint32_t _probed_clocks[SH110X_MAX_CLOCK_STEPS]; ///< fallback ladder
+  uint8_t _probed_count = 0;    ///< entries in the fallback ladder
+  uint8_t _probed_index = 0;    ///< ladder entry currently in use
+  uint8_t _bus_error_count = 0; ///< consecutive failed page transfers
+
+#ifdef SH110X_PROFILE
+  SH110X_FrameStats _stats = {}; ///< cumulative frame statistics
+  void _profileFrame(uint32_t start_us);
+#endif
 };
 
 /*!
@@ -112,6 +463,12 @@ public:
   ~Adafruit_SH1106G(void);
 
   bool begin(uint8_t i2caddr = 0x3C, bool reset = true);
+  bool begin(uint8_t *fb, size_t len, uint8_t i2caddr = 0x3C,
+             bool reset = true);
+  bool beginFast(uint8_t i2caddr = 0x3C, bool reset = true);
+
+protected:
+  bool oled_setStartLine(uint8_t line);
 };
 
 /*!
@@ -132,5 +489,176 @@ public:
   ~Adafruit_SH1107(void);
 
   bool begin(uint8_t i2caddr = 0x3C, bool reset = true);
+  bool begin(uint8_t *fb, size_t len, uint8_t i2caddr = 0x3C,
+             bool reset = true);
+  bool beginFast(uint8_t i2caddr = 0x3C, bool reset = true);
+};
+
+/// Maximum number of panels one SH110X_DisplayGroup can manage
+#define SH110X_GROUP_MAX_DISPLAYS 8
+
+/*!
+    @brief  Manager for several SH110X panels sharing one bus (e.g. four
+            SH1106G heads at different I2C addresses). Instead of running
+            each panel's display() to completion back to back, the group
+            interleaves their page transfers round-robin, so all screens
+            make visible progress together and the fast-clock switching
+            is amortized over the whole update instead of paid per page
+            per panel.
+*/
+class SH110X_DisplayGroup {
+public:
+  SH110X_DisplayGroup(void);
+
+  bool add(Adafruit_SH110X *display);
+  void remove(Adafruit_SH110X *display);
+
+  void displayAll(void);
+  uint8_t displayStepAll(void);
+  bool busy(void);
+
+private:
+  void _holdClocks(bool hold);
+
+  Adafruit_SH110X *_displays[SH110X_GROUP_MAX_DISPLAYS]; ///< managed panels
+  uint8_t _count = 0; ///< number of registered panels
+};
+
+/// Maximum number of sprites one SH110X_SpriteLayer can manage
+#define SH110X_LAYER_MAX_SPRITES 16
+
+/*!
+    @brief  Sprite/tile compositor for icon-and-text-field style UIs
+            (battery gauge, signal bars, status text). Sprites are
+            registered once as vertical-byte page-format bitmaps (see
+            drawBitmapFast() / splash.h layout) and then just moved,
+            shown, hidden or given new frames; composite() repaints only
+            the sprites whose position, content or visibility changed --
+            plus any sprites they overlap -- so a frame costs a handful
+            of byte-wise blits and a few narrow dirty spans instead of a
+            full GFX re-render.
+
+            The layer owns the pixels under its sprites: compositing
+            erases a changed sprite's old and new footprint before
+            repainting, so don't draw other content there. Coordinates
+            are native (rotation 0) framebuffer coordinates, as with
+            drawBitmapFast(); sprite heights must be a multiple of 8,
+            but x and y are unrestricted.
+*/
+class SH110X_SpriteLayer {
+public:
+  SH110X_SpriteLayer(Adafruit_SH110X *display);
+
+  int8_t add(const uint8_t *data, uint8_t w, uint8_t h, int16_t x = 0,
+             int16_t y = 0, bool visible = true);
+  void remove(int8_t id);
+
+  bool move(int8_t id, int16_t x, int16_t y);
+  bool setData(int8_t id, const uint8_t *data);
+  bool show(int8_t id);
+  bool hide(int8_t id);
+
+  bool composite(void);
+
+private:
+  /// One managed sprite and its last composited state
+  struct Sprite {
+    const uint8_t *data; ///< page-format bitmap, w * (h / 8) bytes
+    int16_t x;           ///< current top-left column
+    int16_t y;           ///< current top-left row
+    int16_t drawn_x;     ///< column last composited at
+    int16_t drawn_y;     ///< row last composited at
+    uint8_t w;           ///< width in pixels
+    uint8_t h;           ///< height in pixels (multiple of 8)
+    bool used;           ///< slot is allocated
+    bool visible;        ///< current visibility
+    bool drawn;          ///< footprint is currently on the framebuffer
+    bool dirty;          ///< needs repainting on the next composite()
+  };
+
+  static bool _overlap(int16_t ax, int16_t ay, const Sprite &a, //
+                       const Sprite &b);
+  void _clearRect(int16_t x, int16_t y, uint8_t w, uint8_t h);
+  void _blit(const Sprite &s);
+
+  Adafruit_SH110X *_display; ///< panel composited onto
+  Sprite _sprites[SH110X_LAYER_MAX_SPRITES]; ///< sprite slots
+};
+
+/*!
+    @brief  Compile-time-geometry variant of Adafruit_SH1106G for projects
+            that only ever ship a fixed panel size. Width, height, page
+            count and framebuffer size are constexpr, so they can size
+            static buffers and fold into constants at the call site
+            (e.g. Adafruit_SH1106G_T<128, 64>).
+    @tparam W  Display width in pixels.
+    @tparam H  Display height in pixels.
+*/
+template <uint16_t W, uint16_t H>
+class Adafruit_SH1106G_T : public Adafruit_SH1106G {
+public:
+  static constexpr uint16_t kWidth = W;   ///< display width in pixels
+  static constexpr uint16_t kHeight = H;  ///< display height in pixels
+  static constexpr uint8_t kPages = (H + 7) / 8; ///< 8-row page count
+  /// framebuffer size in bytes, usable to size a static buffer
+  static constexpr size_t kBufferSize = (size_t)W * kPages;
+
+  /*! @brief I2C constructor, see the Adafruit_SH1106G equivalent.
+      @param twi I2C bus @param rst_pin reset pin or -1
+      @param preclk in-library I2C speed @param postclk idle I2C speed */
+  Adafruit_SH1106G_T(TwoWire *twi = &Wire, int16_t rst_pin = -1,
+                     uint32_t preclk = 400000, uint32_t postclk = 100000)
+      : Adafruit_SH1106G(W, H, twi, rst_pin, preclk, postclk) {}
+  /*! @brief Software SPI constructor, see the Adafruit_SH1106G equivalent.
+      @param mosi_pin MOSI pin @param sclk_pin SCLK pin @param dc_pin
+      data/command pin @param rst_pin reset pin or -1 @param cs_pin
+      chip-select pin */
+  Adafruit_SH1106G_T(int16_t mosi_pin, int16_t sclk_pin, int16_t dc_pin,
+                     int16_t rst_pin, int16_t cs_pin)
+      : Adafruit_SH1106G(W, H, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {}
+  /*! @brief Hardware SPI constructor, see the Adafruit_SH1106G equivalent.
+      @param spi SPI bus @param dc_pin data/command pin @param rst_pin
+      reset pin or -1 @param cs_pin chip-select pin @param bitrate SPI
+      clock rate */
+  Adafruit_SH1106G_T(SPIClass *spi, int16_t dc_pin, int16_t rst_pin,
+                     int16_t cs_pin, uint32_t bitrate = 8000000UL)
+      : Adafruit_SH1106G(W, H, spi, dc_pin, rst_pin, cs_pin, bitrate) {}
+};
+
+/*!
+    @brief  Compile-time-geometry variant of Adafruit_SH1107, see
+            Adafruit_SH1106G_T (e.g. Adafruit_SH1107_T<128, 128>).
+    @tparam W  Display width in pixels.
+    @tparam H  Display height in pixels.
+*/
+template <uint16_t W, uint16_t H>
+class Adafruit_SH1107_T : public Adafruit_SH1107 {
+public:
+  static constexpr uint16_t kWidth = W;   ///< display width in pixels
+  static constexpr uint16_t kHeight = H;  ///< display height in pixels
+  static constexpr uint8_t kPages = (H + 7) / 8; ///< 8-row page count
+  /// framebuffer size in bytes, usable to size a static buffer
+  static constexpr size_t kBufferSize = (size_t)W * kPages;
+
+  /*! @brief I2C constructor, see the Adafruit_SH1107 equivalent.
+      @param twi I2C bus @param rst_pin reset pin or -1
+      @param preclk in-library I2C speed @param postclk idle I2C speed */
+  Adafruit_SH1107_T(TwoWire *twi = &Wire, int16_t rst_pin = -1,
+                    uint32_t preclk = 400000, uint32_t postclk = 100000)
+      : Adafruit_SH1107(W, H, twi, rst_pin, preclk, postclk) {}
+  /*! @brief Software SPI constructor, see the Adafruit_SH1107 equivalent.
+      @param mosi_pin MOSI pin @param sclk_pin SCLK pin @param dc_pin
+      data/command pin @param rst_pin reset pin or -1 @param cs_pin
+      chip-select pin */
+  Adafruit_SH1107_T(int16_t mosi_pin, int16_t sclk_pin, int16_t dc_pin,
+                    int16_t rst_pin, int16_t cs_pin)
+      : Adafruit_SH1107(W, H, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {}
+  /*! @brief Hardware SPI constructor, see the Adafruit_SH1107 equivalent.
+      @param spi SPI bus @param dc_pin data/command pin @param rst_pin
+      reset pin or -1 @param cs_pin chip-select pin @param bitrate SPI
+      clock rate */
+  Adafruit_SH1107_T(SPIClass *spi, int16_t dc_pin, int16_t rst_pin,
+                    int16_t cs_pin, uint32_t bitrate = 8000000UL)
+      : Adafruit_SH1107(W, H, spi, dc_pin, rst_pin, cs_pin, bitrate) {}
 };
 #endif // _Adafruit_SH110X_H_
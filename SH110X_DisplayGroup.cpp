@@ -0,0 +1,117 @@
+/*!
+ * @file SH110X_DisplayGroup.cpp
+ *
+ * Manager for several SH110X panels sharing one bus: interleaves their
+ * page transfers round-robin instead of updating each panel to
+ * completion in turn, and amortizes the I2C fast-clock switching over
+ * the whole group update.
+ */
+
+#include "Adafruit_SH110X.h"
+
+/*!
+    @brief  Construct an empty display group.
+*/
+SH110X_DisplayGroup::SH110X_DisplayGroup(void) {
+  for (uint8_t i = 0; i < SH110X_GROUP_MAX_DISPLAYS; i++) {
+    _displays[i] = NULL;
+  }
+}
+
+/*!
+    @brief  Register a display with the group.
+    @param  display
+            Panel to manage; must outlive the group (the group does not
+            take ownership).
+    @return true if added, false if the group is full or display is NULL.
+*/
+bool SH110X_DisplayGroup::add(Adafruit_SH110X *display) {
+  if (!display || (_count >= SH110X_GROUP_MAX_DISPLAYS)) {
+    return false;
+  }
+  _displays[_count++] = display;
+  return true;
+}
+
+/*!
+    @brief  Remove a display from the group.
+    @param  display
+            Panel to drop; unknown pointers are ignored.
+*/
+void SH110X_DisplayGroup::remove(Adafruit_SH110X *display) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_displays[i] == display) {
+      for (uint8_t j = i; j + 1 < _count; j++) {
+        _displays[j] = _displays[j + 1];
+      }
+      _displays[--_count] = NULL;
+      return;
+    }
+  }
+}
+
+/*!
+    @brief  Switch every I2C panel in the group to (or from) its fast
+            clock once, and tell the page send path to skip the per-page
+            switching while the group update runs.
+    @param  hold
+            true before an interleaved update, false after.
+*/
+void SH110X_DisplayGroup::_holdClocks(bool hold) {
+  for (uint8_t i = 0; i < _count; i++) {
+    Adafruit_SH110X *d = _displays[i];
+    if (d->i2c_dev) {
+      d->i2c_dev->setSpeed(hold ? d->i2c_preclk : d->i2c_postclk);
+    }
+    d->_i2c_speed_hold = hold;
+  }
+}
+
+/*!
+    @brief  Check whether any display in the group still has an
+            interleaved frame in flight.
+    @return true while displayStepAll() has work left.
+*/
+bool SH110X_DisplayGroup::busy(void) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_displays[i]->displayBusy()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+    @brief  Advance every display's frame by at most one page, in
+            registration order. Call repeatedly (e.g. from the main loop
+            or a low-priority task) until it returns 0.
+    @return Total pages still pending across the group after this pass.
+*/
+uint8_t SH110X_DisplayGroup::displayStepAll(void) {
+  uint8_t remaining = 0;
+  _holdClocks(true);
+  for (uint8_t i = 0; i < _count; i++) {
+    remaining += _displays[i]->displayStep();
+  }
+  _holdClocks(false);
+  return remaining;
+}
+
+/*!
+    @brief  Update every display in the group, interleaving their page
+            transfers round-robin so all screens make progress together
+            within one frame period instead of updating serially. Blocks
+            until every panel's dirty content has been pushed.
+*/
+void SH110X_DisplayGroup::displayAll(void) {
+  _holdClocks(true);
+  uint8_t remaining;
+  do {
+    remaining = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+      remaining += _displays[i]->displayStep();
+    }
+    yield();
+  } while (remaining);
+  _holdClocks(false);
+}
@@ -0,0 +1,309 @@
+/*!
+ * @file SH110X_SpriteLayer.cpp
+ *
+ * Sprite/tile compositor for SH110X panels: sprites are registered once
+ * as vertical-byte page-format bitmaps and then moved/shown/hidden;
+ * composite() repaints only the sprites that changed (plus anything
+ * they overlap), byte-wise, keeping the dirty spans narrow.
+ */
+
+#include "Adafruit_SH110X.h"
+
+/*!
+    @brief  Construct an empty sprite layer over a display.
+    @param  display
+            Panel to composite onto; must outlive the layer.
+*/
+SH110X_SpriteLayer::SH110X_SpriteLayer(Adafruit_SH110X *display)
+    : _display(display) {
+  for (uint8_t i = 0; i < SH110X_LAYER_MAX_SPRITES; i++) {
+    _sprites[i].used = false;
+    _sprites[i].dirty = false;
+    _sprites[i].drawn = false;
+  }
+}
+
+/*!
+    @brief  Register a sprite with the layer.
+    @param  data
+            Page-format bitmap, w * (h / 8) bytes, laid out like
+            drawBitmapFast() input: h/8 pages of w bytes each, each byte
+            one vertical 8-pixel strip, bit 0 on top. Must stay valid
+            while the sprite is registered (typically PROGMEM-free flash
+            or a static array).
+    @param  w
+            Sprite width in pixels.
+    @param  h
+            Sprite height in pixels; must be a multiple of 8.
+    @param  x
+            Initial top-left column (native coordinates).
+    @param  y
+            Initial top-left row (native coordinates).
+    @param  visible
+            Initial visibility.
+    @return Sprite id for the other calls, or -1 if the layer is full or
+            the arguments are invalid.
+*/
+int8_t SH110X_SpriteLayer::add(const uint8_t *data, uint8_t w, uint8_t h,
+                               int16_t x, int16_t y, bool visible) {
+  if (!data || !w || !h || (h & 7)) {
+    return -1;
+  }
+  for (int8_t i = 0; i < SH110X_LAYER_MAX_SPRITES; i++) {
+    Sprite &s = _sprites[i];
+    if (s.used) {
+      continue;
+    }
+    s.data = data;
+    s.w = w;
+    s.h = h;
+    s.x = x;
+    s.y = y;
+    s.used = true;
+    s.visible = visible;
+    s.drawn = false;
+    s.dirty = visible; // paint on the next composite()
+    return i;
+  }
+  return -1;
+}
+
+/*!
+    @brief  Unregister a sprite. Its pixels are erased on the next
+            composite().
+    @param  id
+            Sprite id from add(); unknown ids are ignored.
+*/
+void SH110X_SpriteLayer::remove(int8_t id) {
+  if ((id < 0) || (id >= SH110X_LAYER_MAX_SPRITES) || !_sprites[id].used) {
+    return;
+  }
+  _sprites[id].used = false;
+  _sprites[id].visible = false;
+  _sprites[id].dirty = true; // footprint still needs erasing
+}
+
+/*!
+    @brief  Move a sprite.
+    @param  id
+            Sprite id from add().
+    @param  x
+            New top-left column (native coordinates).
+    @param  y
+            New top-left row (native coordinates).
+    @return true if the sprite exists, false otherwise.
+*/
+bool SH110X_SpriteLayer::move(int8_t id, int16_t x, int16_t y) {
+  if ((id < 0) || (id >= SH110X_LAYER_MAX_SPRITES) || !_sprites[id].used) {
+    return false;
+  }
+  Sprite &s = _sprites[id];
+  if ((s.x != x) || (s.y != y)) {
+    s.x = x;
+    s.y = y;
+    s.dirty = true;
+  }
+  return true;
+}
+
+/*!
+    @brief  Swap a sprite's bitmap (e.g. the next animation frame, or a
+            battery icon at a different charge level). Same layout and
+            size as the bitmap passed to add().
+    @param  id
+            Sprite id from add().
+    @param  data
+            New page-format bitmap, w * (h / 8) bytes.
+    @return true if the sprite exists and data is valid, false otherwise.
+*/
+bool SH110X_SpriteLayer::setData(int8_t id, const uint8_t *data) {
+  if ((id < 0) || (id >= SH110X_LAYER_MAX_SPRITES) || !_sprites[id].used ||
+      !data) {
+    return false;
+  }
+  Sprite &s = _sprites[id];
+  if (s.data != data) {
+    s.data = data;
+    s.dirty = true;
+  }
+  return true;
+}
+
+/*!
+    @brief  Make a sprite visible.
+    @param  id
+            Sprite id from add().
+    @return true if the sprite exists, false otherwise.
+*/
+bool SH110X_SpriteLayer::show(int8_t id) {
+  if ((id < 0) || (id >= SH110X_LAYER_MAX_SPRITES) || !_sprites[id].used) {
+    return false;
+  }
+  if (!_sprites[id].visible) {
+    _sprites[id].visible = true;
+    _sprites[id].dirty = true;
+  }
+  return true;
+}
+
+/*!
+    @brief  Hide a sprite without unregistering it.
+    @param  id
+            Sprite id from add().
+    @return true if the sprite exists, false otherwise.
+*/
+bool SH110X_SpriteLayer::hide(int8_t id) {
+  if ((id < 0) || (id >= SH110X_LAYER_MAX_SPRITES) || !_sprites[id].used) {
+    return false;
+  }
+  if (_sprites[id].visible) {
+    _sprites[id].visible = false;
+    _sprites[id].dirty = true;
+  }
+  return true;
+}
+
+/*!
+    @brief  Check whether the footprint of sprite a, placed at (ax, ay),
+            overlaps sprite b's current footprint.
+*/
+bool SH110X_SpriteLayer::_overlap(int16_t ax, int16_t ay, const Sprite &a,
+                                  const Sprite &b) {
+  return (ax < b.x + b.w) && (b.x < ax + a.w) && //
+         (ay < b.y + b.h) && (b.y < ay + a.h);
+}
+
+/*!
+    @brief  Clear a rectangle of the display's framebuffer to black,
+            byte/mask-wise, marking the touched columns dirty.
+*/
+void SH110X_SpriteLayer::_clearRect(int16_t x, int16_t y, uint8_t w,
+                                    uint8_t h) {
+  int16_t x0 = max(x, (int16_t)0);
+  int16_t x1 = min((int16_t)(x + w), _display->WIDTH); // exclusive
+  int16_t y0 = max(y, (int16_t)0);
+  int16_t y1 = min((int16_t)(y + h), _display->HEIGHT); // exclusive
+  if ((x0 >= x1) || (y0 >= y1)) {
+    return;
+  }
+  for (uint8_t p = y0 / 8; p <= (y1 - 1) / 8; p++) {
+    // bits of this page that fall inside [y0, y1)
+    uint8_t mask = 0xFF;
+    if (p == y0 / 8) {
+      mask &= (uint8_t)(0xFF << (y0 & 7));
+    }
+    if (p == (y1 - 1) / 8) {
+      mask &= (uint8_t)(0xFF >> (7 - ((y1 - 1) & 7)));
+    }
+    uint8_t *dst = _display->buffer + (uint16_t)p * (uint16_t)_display->WIDTH;
+    for (int16_t i = x0; i < x1; i++) {
+      dst[i] &= (uint8_t)~mask;
+    }
+    _display->_markDirty(p, (uint8_t)x0, (uint8_t)(x1 - 1));
+  }
+}
+
+/*!
+    @brief  OR a sprite's page-format bitmap into the framebuffer at its
+            current position, handling arbitrary (including negative) x
+            and y; a byte whose strip straddles a page boundary is split
+            across the two destination pages with shifts.
+*/
+void SH110X_SpriteLayer::_blit(const Sprite &s) {
+  int16_t x0 = max(s.x, (int16_t)0);
+  int16_t x1 = min((int16_t)(s.x + s.w), _display->WIDTH); // exclusive
+  if (x0 >= x1) {
+    return;
+  }
+  uint8_t pages = (_display->HEIGHT + 7) / 8;
+  for (uint8_t sp = 0; sp < s.h / 8; sp++) {
+    int16_t yy = s.y + sp * 8;
+    int16_t p0 = yy >> 3;      // floor, also for negative yy
+    uint8_t shift = yy & 7;    // strip offset within the page
+    const uint8_t *src = s.data + (uint16_t)sp * s.w + (x0 - s.x);
+    if ((p0 >= 0) && (p0 < pages)) {
+      uint8_t *dst = _display->buffer + (uint16_t)p0 * (uint16_t)_display->WIDTH;
+      for (int16_t i = x0; i < x1; i++) {
+        dst[i] |= (uint8_t)(src[i - x0] << shift);
+      }
+      _display->_markDirty((uint8_t)p0, (uint8_t)x0, (uint8_t)(x1 - 1));
+    }
+    if (shift && (p0 + 1 >= 0) && (p0 + 1 < pages)) {
+      uint8_t *dst =
+          _display->buffer + (uint16_t)(p0 + 1) * (uint16_t)_display->WIDTH;
+      for (int16_t i = x0; i < x1; i++) {
+        dst[i] |= (uint8_t)(src[i - x0] >> (8 - shift));
+      }
+      _display->_markDirty((uint8_t)(p0 + 1), (uint8_t)x0, (uint8_t)(x1 - 1));
+    }
+  }
+}
+
+/*!
+    @brief  Repaint every sprite whose position, content or visibility
+            changed since the last composite(), plus any sprites their
+            footprints overlap. Only the affected framebuffer bytes are
+            touched, so the dirty spans pushed by the next display()
+            stay as narrow as the sprites themselves.
+    @return true if anything was repainted (i.e. a display() call is
+            worthwhile), false if the layer was already up to date.
+*/
+bool SH110X_SpriteLayer::composite(void) {
+  if (!_display->buffer) {
+    return false; // streaming mode has no framebuffer to composite into
+  }
+
+  // Erasing a changed sprite's footprint would punch a hole in any clean
+  // sprite painted over the same bytes, so overlap damage cascades until
+  // the dirty set stops growing.
+  bool grew;
+  do {
+    grew = false;
+    for (uint8_t i = 0; i < SH110X_LAYER_MAX_SPRITES; i++) {
+      if (!_sprites[i].dirty || !_sprites[i].drawn) {
+        continue;
+      }
+      for (uint8_t j = 0; j < SH110X_LAYER_MAX_SPRITES; j++) {
+        if ((j == i) || _sprites[j].dirty || !_sprites[j].drawn) {
+          continue;
+        }
+        if (_overlap(_sprites[i].drawn_x, _sprites[i].drawn_y, _sprites[i],
+                     _sprites[j])) {
+          _sprites[j].dirty = true;
+          grew = true;
+        }
+      }
+    }
+  } while (grew);
+
+  // erase the old footprint of everything being repainted
+  bool any = false;
+  for (uint8_t i = 0; i < SH110X_LAYER_MAX_SPRITES; i++) {
+    Sprite &s = _sprites[i];
+    if (!s.dirty) {
+      continue;
+    }
+    any = true;
+    if (s.drawn) {
+      _clearRect(s.drawn_x, s.drawn_y, s.w, s.h);
+    }
+  }
+
+  // repaint in registration order (overlaps OR together)
+  for (uint8_t i = 0; i < SH110X_LAYER_MAX_SPRITES; i++) {
+    Sprite &s = _sprites[i];
+    if (!s.dirty) {
+      continue;
+    }
+    if (s.used && s.visible) {
+      _blit(s);
+      s.drawn = true;
+      s.drawn_x = s.x;
+      s.drawn_y = s.y;
+    } else {
+      s.drawn = false;
+    }
+    s.dirty = false;
+  }
+  return any;
+}
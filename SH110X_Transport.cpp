@@ -0,0 +1,121 @@
+/*!
+ * @file SH110X_Transport.cpp
+ *
+ * Stock implementations of the pluggable frame-transfer interface
+ * (see SH110X_Transport in Adafruit_SH110X.h): a shared fixed-size op
+ * queue, plus I2C and SPI backends that replay it with the same framing
+ * as the built-in transfer path. Platform-specific DMA/async backends
+ * implement the same three calls and are installed with
+ * Adafruit_SH110X::setTransport().
+ */
+
+#include "Adafruit_SH110X.h"
+
+/*!
+    @brief  Append a command burst to the queue. The bytes are copied,
+            so the caller's buffer may go out of scope immediately.
+    @param  cmds
+            Command bytes, at most SH110X_TRANSPORT_CMD_MAX.
+    @param  n
+            Number of bytes.
+    @return false if the arguments are invalid or the queue is full.
+*/
+bool SH110X_QueuedTransport::queueCommand(const uint8_t *cmds, uint8_t n) {
+  if (!cmds || !n || (n > SH110X_TRANSPORT_CMD_MAX) ||
+      (_op_count >= SH110X_TRANSPORT_MAX_OPS)) {
+    return false;
+  }
+  Op &op = _ops[_op_count++];
+  op.data = NULL;
+  op.len = 0;
+  op.cmd_len = n;
+  memcpy(op.cmd, cmds, n);
+  return true;
+}
+
+/*!
+    @brief  Append a data run to the queue. Zero-copy: only the pointer
+            is stored, and the caller keeps the bytes valid and
+            unmodified until flush() returns.
+    @param  data
+            Data run start.
+    @param  len
+            Number of bytes.
+    @return false if the arguments are invalid or the queue is full.
+*/
+bool SH110X_QueuedTransport::queueData(const uint8_t *data, uint16_t len) {
+  if (!data || !len || (_op_count >= SH110X_TRANSPORT_MAX_OPS)) {
+    return false;
+  }
+  Op &op = _ops[_op_count++];
+  op.data = data;
+  op.len = len;
+  op.cmd_len = 0;
+  return true;
+}
+
+/*!
+    @brief  Replay the queue over I2C: command bursts behind a 0x00
+            control byte, data runs behind 0x40, chunked to the device's
+            transfer buffer, with the bus clock raised to the 'during'
+            speed for the replay and dropped back afterwards -- the same
+            switching the built-in path does per page, paid once per
+            frame here. The queue is emptied whether or not every write
+            succeeds; failed content stays dirty on the display side and
+            is requeued next frame.
+    @return true if the whole sequence was acknowledged.
+*/
+bool SH110X_I2CTransport::flush(void) {
+  bool ok = true;
+  uint16_t maxbuff = _dev->maxBufferSize();
+  _dev->setSpeed(_preclk);
+  for (uint8_t i = 0; ok && (i < _op_count); i++) {
+    Op &op = _ops[i];
+    if (op.cmd_len) {
+      uint8_t ctrl = 0x00;
+      ok = _dev->write(op.cmd, op.cmd_len, true, &ctrl, 1);
+    } else {
+      uint8_t dc_byte = 0x40;
+      const uint8_t *ptr = op.data;
+      uint16_t remaining = op.len;
+      while (ok && remaining) {
+        uint16_t chunk = min(remaining, (uint16_t)(maxbuff - 1));
+        ok = _dev->write(ptr, chunk, true, &dc_byte, 1);
+        ptr += chunk;
+        remaining -= chunk;
+      }
+    }
+  }
+  _dev->setSpeed(_postclk);
+  _op_count = 0;
+  return ok;
+}
+
+/*!
+    @brief  Replay the queue over SPI inside one CS-asserted
+            transaction, toggling the D/C pin per op. Command bytes go
+            out from a stack copy and data runs byte by byte, because
+            the bulk transfer() overwrites its buffer in place and the
+            data is caller-owned.
+    @return true (raw SPI transfers report no errors).
+*/
+bool SH110X_SPITransport::flush(void) {
+  _dev->beginTransactionWithAssertingCS();
+  for (uint8_t i = 0; i < _op_count; i++) {
+    Op &op = _ops[i];
+    if (op.cmd_len) {
+      uint8_t tmp[SH110X_TRANSPORT_CMD_MAX];
+      memcpy(tmp, op.cmd, op.cmd_len);
+      digitalWrite(_dc, LOW);
+      _dev->transfer(tmp, op.cmd_len);
+    } else {
+      digitalWrite(_dc, HIGH);
+      for (uint16_t j = 0; j < op.len; j++) {
+        _dev->transfer(op.data[j]);
+      }
+    }
+  }
+  _dev->endTransactionWithDeassertingCS();
+  _op_count = 0;
+  return true;
+}
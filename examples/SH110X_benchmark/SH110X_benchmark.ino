@@ -0,0 +1,234 @@
+// SH110X benchmark suite
+//
+// Times the library's hot paths with standardized workloads and prints
+// fps / bytes-per-frame tables over Serial, so performance claims (and
+// regressions between releases) can be quantified on real boards:
+//   - full-frame display() pushes
+//   - small dirty-rect updates (status-field style)
+//   - text scrolling, both framebuffer redraw and scrollVertical()
+//   - bitmap blits, drawBitmap() vs drawBitmapFast()
+//
+// For I2C panels the whole suite is repeated at several bus clocks via
+// the preclk constructor parameter; rebuild with OLED_SPI for SPI wiring.
+// Build with -DSH110X_PROFILE to also print the command/data byte and
+// timing breakdown from getFrameStats().
+
+#include <SPI.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SH110X.h>
+
+// Uncomment the panel being measured:
+#define PANEL_SH1106G_128x64
+// #define PANEL_SH1107_128x128
+
+// #define OLED_SPI
+#define OLED_DC 8
+#define OLED_CS 10
+#define OLED_RST -1
+
+#define FRAMES_PER_TEST 20
+
+// I2C clocks to sweep (the 'preclk' constructor argument)
+static const uint32_t i2c_clocks[] = {100000, 400000, 1000000};
+
+static Adafruit_SH110X *display = NULL;
+
+// 24x24 page-format test sprite (3 pages x 24 columns), diagonal stripes
+static uint8_t sprite_fast[3 * 24];
+// same sprite as a conventional horizontal-scan bitmap for drawBitmap()
+static uint8_t sprite_slow[24 * 3];
+
+static void makeSprites() {
+  for (uint8_t b = 0; b < 3; b++) {
+    for (uint8_t x = 0; x < 24; x++) {
+      sprite_fast[b * 24 + x] = 0x0F << ((x + b) & 3);
+    }
+  }
+  for (uint8_t y = 0; y < 24; y++) {
+    for (uint8_t xb = 0; xb < 3; xb++) {
+      sprite_slow[y * 3 + xb] = (y & 4) ? 0x55 : 0xAA;
+    }
+  }
+}
+
+// begin() lives on the concrete panel classes, so construct and init
+// here and hand back the common base class pointer
+static Adafruit_SH110X *makeDisplay(uint32_t preclk) {
+#if defined(OLED_SPI)
+  (void)preclk;
+#if defined(PANEL_SH1107_128x128)
+  Adafruit_SH1107 *d =
+      new Adafruit_SH1107(128, 128, &SPI, OLED_DC, OLED_RST, OLED_CS);
+#else
+  Adafruit_SH1106G *d =
+      new Adafruit_SH1106G(128, 64, &SPI, OLED_DC, OLED_RST, OLED_CS);
+#endif
+#else
+#if defined(PANEL_SH1107_128x128)
+  Adafruit_SH1107 *d = new Adafruit_SH1107(128, 128, &Wire, OLED_RST, preclk);
+#else
+  Adafruit_SH1106G *d = new Adafruit_SH1106G(128, 64, &Wire, OLED_RST, preclk);
+#endif
+#endif
+  if (!d->begin(0x3C, true)) {
+    delete d;
+    return NULL;
+  }
+  return d;
+}
+
+// report one measurement: total microseconds for 'frames' iterations
+static void report(const char *name, uint32_t total_us, uint16_t frames) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(total_us / frames);
+  Serial.print(" us/frame, ");
+  Serial.print(1000000.0 * frames / total_us, 1);
+  Serial.println(" fps");
+}
+
+#ifdef SH110X_PROFILE
+static void reportStats() {
+  SH110X_FrameStats s = display->getFrameStats();
+  Serial.print("  bus: ");
+  Serial.print(s.cmd_bytes);
+  Serial.print(" cmd bytes / ");
+  Serial.print(s.data_bytes);
+  Serial.print(" data bytes, pages ");
+  Serial.print(s.pages_sent);
+  Serial.print(" sent / ");
+  Serial.print(s.pages_skipped);
+  Serial.println(" skipped");
+  display->resetFrameStats();
+}
+#else
+static void reportStats() {}
+#endif
+
+static void benchFullFrame() {
+  uint32_t total = 0;
+  for (uint16_t f = 0; f < FRAMES_PER_TEST; f++) {
+    display->fillRect(0, 0, display->width(), display->height(),
+                      (f & 1) ? SH110X_WHITE : SH110X_BLACK);
+    uint32_t t0 = micros();
+    display->display();
+    total += micros() - t0;
+  }
+  report("full frame", total, FRAMES_PER_TEST);
+  reportStats();
+}
+
+static void benchDirtyRect() {
+  display->clearDisplay();
+  display->display();
+  uint32_t total = 0;
+  for (uint16_t f = 0; f < FRAMES_PER_TEST; f++) {
+    // a counter field in one corner, like a status screen would update
+    display->fillRect(0, 0, 36, 8, SH110X_BLACK);
+    display->setCursor(0, 0);
+    display->setTextColor(SH110X_WHITE);
+    display->print(f);
+    uint32_t t0 = micros();
+    display->display();
+    total += micros() - t0;
+  }
+  report("dirty rect", total, FRAMES_PER_TEST);
+  reportStats();
+}
+
+static void benchTextScroll() {
+  display->clearDisplay();
+  display->setTextColor(SH110X_WHITE);
+  uint32_t total = 0;
+  for (uint16_t f = 0; f < FRAMES_PER_TEST; f++) {
+    // full software scroll: repaint every text row
+    display->clearDisplay();
+    for (uint8_t row = 0; row < display->height() / 8; row++) {
+      display->setCursor(0, row * 8);
+      display->print("line ");
+      display->print(f + row);
+    }
+    uint32_t t0 = micros();
+    display->display();
+    total += micros() - t0;
+  }
+  report("text scroll (redraw)", total, FRAMES_PER_TEST);
+  reportStats();
+
+  total = 0;
+  for (uint16_t f = 0; f < FRAMES_PER_TEST; f++) {
+    uint32_t t0 = micros();
+    display->scrollVertical(8); // hardware start-line scroll
+    total += micros() - t0;
+  }
+  display->scrollVertical(-8 * FRAMES_PER_TEST);
+  report("text scroll (hardware)", total, FRAMES_PER_TEST);
+  reportStats();
+}
+
+static void benchBlit() {
+  display->clearDisplay();
+  display->display();
+  uint32_t total = 0;
+  for (uint16_t f = 0; f < FRAMES_PER_TEST; f++) {
+    uint32_t t0 = micros();
+    display->drawBitmap((f * 3) % 96, 16, sprite_slow, 24, 24, SH110X_WHITE);
+    total += micros() - t0;
+  }
+  report("blit drawBitmap", total, FRAMES_PER_TEST);
+
+  total = 0;
+  for (uint16_t f = 0; f < FRAMES_PER_TEST; f++) {
+    uint32_t t0 = micros();
+    display->drawBitmapFast((f * 3) % 96, 16, sprite_fast, 24, 24);
+    total += micros() - t0;
+  }
+  report("blit drawBitmapFast", total, FRAMES_PER_TEST);
+  display->display();
+}
+
+static void runSuite(uint32_t preclk) {
+#if defined(OLED_SPI)
+  Serial.println("\n--- SPI ---");
+#else
+  Serial.print("\n--- I2C @ ");
+  Serial.print(preclk / 1000);
+  Serial.println(" kHz ---");
+#endif
+
+  delete display;
+  display = makeDisplay(preclk);
+  if (!display) {
+    Serial.println("begin() failed!");
+    return;
+  }
+#ifdef SH110X_PROFILE
+  display->resetFrameStats();
+#endif
+
+  benchFullFrame();
+  benchDirtyRect();
+  benchTextScroll();
+  benchBlit();
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+  Serial.println("SH110X benchmark suite");
+
+  makeSprites();
+
+#if defined(OLED_SPI)
+  runSuite(0);
+#else
+  for (uint8_t i = 0; i < sizeof(i2c_clocks) / sizeof(i2c_clocks[0]); i++) {
+    runSuite(i2c_clocks[i]);
+  }
+#endif
+  Serial.println("\ndone");
+}
+
+void loop() { delay(1000); }
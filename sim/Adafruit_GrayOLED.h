@@ -0,0 +1,70 @@
+/*!
+ * @file Adafruit_GrayOLED.h
+ *
+ * Adafruit_GrayOLED stub for the host-side simulation: framebuffer
+ * allocation, pixel access with rotation, the dirty window and the
+ * oled_command plumbing, routed to the stub bus devices.
+ */
+#ifndef _SH110X_SIM_ADAFRUIT_GRAYOLED_H_
+#define _SH110X_SIM_ADAFRUIT_GRAYOLED_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_I2CDevice.h"
+#include "Adafruit_SPIDevice.h"
+#include "Arduino.h"
+
+#define MONOOLED_BLACK 0
+#define MONOOLED_WHITE 1
+#define MONOOLED_INVERSE 2
+
+#define GRAYOLED_SETCONTRAST 0x81
+#define GRAYOLED_NORMALDISPLAY 0xA6
+#define GRAYOLED_INVERTDISPLAY 0xA7
+
+class Adafruit_GrayOLED : public Adafruit_GFX {
+public:
+  Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h, TwoWire *twi = &Wire,
+                    int8_t rst_pin = -1, uint32_t preclk = 400000,
+                    uint32_t postclk = 100000);
+  Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h, int8_t mosi_pin,
+                    int8_t sclk_pin, int8_t dc_pin, int8_t rst_pin,
+                    int8_t cs_pin);
+  Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h, SPIClass *spi,
+                    int8_t dc_pin, int8_t rst_pin, int8_t cs_pin,
+                    uint32_t bitrate = 8000000UL);
+  virtual ~Adafruit_GrayOLED();
+
+  virtual void display(void) = 0;
+  void clearDisplay(void);
+  void invertDisplay(bool i);
+  void setContrast(uint8_t contrastlevel);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  bool getPixel(int16_t x, int16_t y);
+  uint8_t *getBuffer(void);
+
+  bool oled_command(uint8_t c);
+  bool oled_commandList(const uint8_t *c, uint8_t n);
+
+protected:
+  bool _init(uint8_t i2caddr = 0x3C, bool reset = true);
+
+  Adafruit_SPIDevice *spi_dev = nullptr;
+  Adafruit_I2CDevice *i2c_dev = nullptr;
+  int32_t i2caddr = 0;
+  int32_t mosiPin = -1, clkPin = -1, dcPin = -1, csPin = -1, rstPin = -1;
+  uint32_t preclk = 400000, postclk = 100000;
+
+  uint8_t *buffer = nullptr;
+
+  int16_t window_x1, window_y1, window_x2, window_y2;
+
+  int dcs = 0;
+  uint8_t _bpp = 1;
+
+  uint32_t i2c_preclk = 400000, i2c_postclk = 100000;
+
+private:
+  TwoWire *_theWire = nullptr;
+};
+
+#endif // _SH110X_SIM_ADAFRUIT_GRAYOLED_H_
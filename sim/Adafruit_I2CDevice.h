@@ -0,0 +1,78 @@
+/*!
+ * @file Adafruit_I2CDevice.h
+ *
+ * Adafruit_I2CDevice stub for the host-side simulation: same write()
+ * surface as BusIO, but instead of touching hardware it counts bytes,
+ * accumulates modeled bus time (see sim_bus.h) and optionally hands
+ * every transmission to a test sink for byte-exact assertions.
+ */
+#ifndef _SH110X_SIM_ADAFRUIT_I2CDEVICE_H_
+#define _SH110X_SIM_ADAFRUIT_I2CDEVICE_H_
+#include "Arduino.h"
+#include "Wire.h"
+#include "sim_bus.h"
+
+class Adafruit_I2CDevice {
+public:
+  Adafruit_I2CDevice(uint8_t addr, TwoWire *theWire = &Wire)
+      : _addr(addr), _wire(theWire) {}
+  uint8_t address(void) { return _addr; }
+  bool begin(bool addr_detect = true) {
+    (void)addr_detect;
+    return true;
+  }
+  void end(void) {}
+  bool detected(void) { return !_fail; }
+  bool write(const uint8_t *buffer, size_t len, bool stop = true,
+             const uint8_t *prefix_buffer = nullptr, size_t prefix_len = 0) {
+    (void)stop;
+    if (_fail) {
+      return false;
+    }
+    size_t payload = len + prefix_len;
+    simbus_i2c.transactions++;
+    simbus_i2c.bytes += payload;
+    // 9 bit times per byte (8 data + ACK), plus the address byte
+    simbus_i2c.modeled_ns +=
+        (uint64_t)(payload + 1) * 9 * 1000000000ULL / speed +
+        simbus_i2c_overhead_ns;
+    if (_sink) {
+      _sink(prefix_buffer, prefix_len, buffer, len, _sink_ctx);
+    }
+    return true;
+  }
+  bool read(uint8_t *buffer, size_t len, bool stop = true) {
+    (void)buffer;
+    (void)len;
+    (void)stop;
+    return !_fail;
+  }
+  bool setSpeed(uint32_t desiredclk) {
+    speed = desiredclk;
+    speed_changes++;
+    return true;
+  }
+  size_t maxBufferSize() { return _maxbuf; }
+
+  // --- simulation instrumentation (host build only) ---
+  typedef void (*WriteSink)(const uint8_t *prefix, size_t prefix_len,
+                            const uint8_t *data, size_t len, void *ctx);
+  void setWriteSink(WriteSink s, void *ctx) {
+    _sink = s;
+    _sink_ctx = ctx;
+  }
+  void setMaxBufferSize(size_t s) { _maxbuf = s; }
+  void setFail(bool f) { _fail = f; }
+  uint32_t speed_changes = 0;
+  uint32_t speed = 100000;
+
+private:
+  uint8_t _addr;
+  TwoWire *_wire;
+  size_t _maxbuf = 32;
+  bool _fail = false;
+  WriteSink _sink = nullptr;
+  void *_sink_ctx = nullptr;
+};
+
+#endif // _SH110X_SIM_ADAFRUIT_I2CDEVICE_H_
@@ -0,0 +1,102 @@
+/*!
+ * @file Adafruit_SPIDevice.h
+ *
+ * Adafruit_SPIDevice stub for the host-side simulation: same surface as
+ * BusIO (including the frame-transaction helpers the library uses), but
+ * it counts bytes and accumulates modeled bus time instead of touching
+ * hardware. A CS assertion is counted as one transaction; write() calls
+ * outside a held transaction count their own.
+ */
+#ifndef _SH110X_SIM_ADAFRUIT_SPIDEVICE_H_
+#define _SH110X_SIM_ADAFRUIT_SPIDEVICE_H_
+#include "Arduino.h"
+#include "SPI.h"
+#include "sim_bus.h"
+
+typedef enum {
+  SPI_BITORDER_MSBFIRST = 1,
+  SPI_BITORDER_LSBFIRST = 0
+} BusIOBitOrder;
+
+class Adafruit_SPIDevice {
+public:
+  Adafruit_SPIDevice(int8_t cspin, uint32_t freq = 1000000,
+                     BusIOBitOrder dataOrder = SPI_BITORDER_MSBFIRST,
+                     uint8_t dataMode = SPI_MODE0, SPIClass *theSPI = &SPI)
+      : _cs(cspin), _freq(freq) {
+    (void)dataOrder;
+    (void)dataMode;
+    (void)theSPI;
+  }
+  Adafruit_SPIDevice(int8_t cspin, int8_t sckpin, int8_t misopin,
+                     int8_t mosipin, uint32_t freq = 1000000,
+                     BusIOBitOrder dataOrder = SPI_BITORDER_MSBFIRST,
+                     uint8_t dataMode = SPI_MODE0)
+      : _cs(cspin), _freq(freq) {
+    (void)sckpin;
+    (void)misopin;
+    (void)mosipin;
+    (void)dataOrder;
+    (void)dataMode;
+  }
+  bool begin(void) { return true; }
+  bool write(const uint8_t *buffer, size_t len,
+             const uint8_t *prefix_buffer = nullptr, size_t prefix_len = 0) {
+    if (_fail) {
+      return false;
+    }
+    if (!_held) {
+      simbus_spi.transactions++;
+      simbus_spi.modeled_ns += simbus_spi_overhead_ns;
+    }
+    _account(len + prefix_len);
+    if (_sink) {
+      _sink(prefix_buffer, prefix_len, buffer, len, _sink_ctx);
+    }
+    return true;
+  }
+  uint8_t transfer(uint8_t send) {
+    _account(1);
+    if (_sink) {
+      _sink(nullptr, 0, &send, 1, _sink_ctx);
+    }
+    return send;
+  }
+  void transfer(uint8_t *buffer, size_t len) {
+    _account(len);
+    if (_sink) {
+      _sink(nullptr, 0, buffer, len, _sink_ctx);
+    }
+  }
+  void beginTransaction(void) {}
+  void endTransaction(void) {}
+  void beginTransactionWithAssertingCS(void) {
+    simbus_spi.transactions++;
+    simbus_spi.modeled_ns += simbus_spi_overhead_ns;
+    _held = true;
+  }
+  void endTransactionWithDeassertingCS(void) { _held = false; }
+
+  // --- simulation instrumentation (host build only) ---
+  typedef void (*WriteSink)(const uint8_t *prefix, size_t prefix_len,
+                            const uint8_t *data, size_t len, void *ctx);
+  void setWriteSink(WriteSink s, void *ctx) {
+    _sink = s;
+    _sink_ctx = ctx;
+  }
+  void setFail(bool f) { _fail = f; }
+
+private:
+  void _account(size_t n) {
+    simbus_spi.bytes += n;
+    simbus_spi.modeled_ns += (uint64_t)n * 8 * 1000000000ULL / _freq;
+  }
+  int8_t _cs;
+  uint32_t _freq;
+  bool _fail = false;
+  bool _held = false;
+  WriteSink _sink = nullptr;
+  void *_sink_ctx = nullptr;
+};
+
+#endif // _SH110X_SIM_ADAFRUIT_SPIDEVICE_H_
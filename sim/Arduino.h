@@ -0,0 +1,103 @@
+/*!
+ * @file Arduino.h
+ *
+ * Minimal Arduino core stub for the host-side simulation build. Only
+ * the pieces the SH110X library actually touches are provided; timing
+ * functions are backed by the host monotonic clock (sim_core.cpp).
+ */
+#ifndef _SH110X_SIM_ARDUINO_H_
+#define _SH110X_SIM_ARDUINO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define pgm_read_pointer(addr) (*(void *const *)(addr))
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef abs
+#define abs(x) ((x) > 0 ? (x) : -(x))
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int val);
+int digitalRead(int pin);
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+class __FlashStringHelper;
+#define F(s) (s)
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = 10);
+  size_t print(unsigned int v, int base = 10);
+  size_t print(long v, int base = 10);
+  size_t print(unsigned long v, int base = 10);
+  size_t print(double v, int digits = 2);
+  size_t println(void) { return write('\n'); }
+  size_t println(const char *s) { return print(s) + println(); }
+  size_t println(char c) { return print(c) + println(); }
+  size_t println(int v, int base = 10) { return print(v, base) + println(); }
+  size_t println(unsigned int v, int base = 10) {
+    return print(v, base) + println();
+  }
+  size_t println(long v, int base = 10) { return print(v, base) + println(); }
+  size_t println(unsigned long v, int base = 10) {
+    return print(v, base) + println();
+  }
+  size_t println(double v, int digits = 2) {
+    return print(v, digits) + println();
+  }
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  operator bool() { return true; }
+  size_t write(uint8_t c) override {
+    fputc(c, stdout);
+    return 1;
+  }
+};
+
+extern HardwareSerial Serial;
+
+#endif // _SH110X_SIM_ARDUINO_H_
@@ -0,0 +1,36 @@
+/*!
+ * @file SPI.h
+ *
+ * SPIClass stub for the host-side simulation. Transfer accounting and
+ * timing live in Adafruit_SPIDevice.h, which is what the library talks
+ * to; this type only needs to exist for the constructors.
+ */
+#ifndef _SH110X_SIM_SPI_H_
+#define _SH110X_SIM_SPI_H_
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0
+
+class SPISettings {
+public:
+  SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST,
+              uint8_t dataMode = SPI_MODE0)
+      : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+  uint32_t _clock;
+  uint8_t _bitOrder, _dataMode;
+};
+
+class SPIClass {
+public:
+  void begin(void) {}
+  void end(void) {}
+  void beginTransaction(SPISettings s) { (void)s; }
+  void endTransaction(void) {}
+  uint8_t transfer(uint8_t b) { return b; }
+};
+
+extern SPIClass SPI;
+
+#endif // _SH110X_SIM_SPI_H_
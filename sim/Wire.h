@@ -0,0 +1,24 @@
+/*!
+ * @file Wire.h
+ *
+ * TwoWire stub for the host-side simulation; only carries the clock
+ * rate, which feeds the bus-timing model in Adafruit_I2CDevice.h.
+ */
+#ifndef _SH110X_SIM_WIRE_H_
+#define _SH110X_SIM_WIRE_H_
+#include "Arduino.h"
+
+class TwoWire {
+public:
+  void begin(void) {}
+  void end(void) {}
+  void setClock(uint32_t hz) { _clock = hz; }
+  uint32_t getClock(void) { return _clock; }
+
+private:
+  uint32_t _clock = 100000;
+};
+
+extern TwoWire Wire;
+
+#endif // _SH110X_SIM_WIRE_H_
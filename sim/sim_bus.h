@@ -0,0 +1,40 @@
+/*!
+ * @file sim_bus.h
+ *
+ * Bus-timing model and counters for the host-side simulation. The stub
+ * I2C/SPI devices account every byte they would have clocked out and
+ * accumulate a modeled wall time:
+ *
+ *   time = bits / clock_rate + per_transaction_overhead
+ *
+ * I2C pays 9 bit times per byte (8 data + ACK) plus one address byte
+ * per transaction; SPI pays 8 bit times per byte. The per-transaction
+ * overhead stands in for start/stop conditions, CS setup and driver
+ * call cost, and is adjustable per scenario.
+ */
+#ifndef _SH110X_SIM_BUS_H_
+#define _SH110X_SIM_BUS_H_
+
+#include <stdint.h>
+
+struct SH110X_SimBusStats {
+  uint32_t transactions = 0; ///< start/stop pairs resp. CS assertions
+  uint64_t bytes = 0;        ///< payload bytes clocked onto the bus
+  uint64_t modeled_ns = 0;   ///< accumulated modeled bus time
+
+  void reset(void) {
+    transactions = 0;
+    bytes = 0;
+    modeled_ns = 0;
+  }
+  double modeled_ms(void) const { return (double)modeled_ns / 1e6; }
+};
+
+extern SH110X_SimBusStats simbus_i2c;
+extern SH110X_SimBusStats simbus_spi;
+
+/*! Per-transaction overhead, tunable to match a measured platform. */
+extern uint32_t simbus_i2c_overhead_ns; // default 5000 (Wire start/stop)
+extern uint32_t simbus_spi_overhead_ns; // default 1000 (CS + settings)
+
+#endif // _SH110X_SIM_BUS_H_
@@ -0,0 +1,345 @@
+/*!
+ * @file sim_core.cpp
+ *
+ * Host-side implementations backing the stub headers: Arduino timing on
+ * the host monotonic clock, the GFX drawing primitives, and enough of
+ * Adafruit_GrayOLED for the SH110X library to run unmodified.
+ */
+#include <chrono>
+#include <thread>
+
+#include "Adafruit_GrayOLED.h"
+#include "sim_bus.h"
+
+SH110X_SimBusStats simbus_i2c;
+SH110X_SimBusStats simbus_spi;
+uint32_t simbus_i2c_overhead_ns = 5000;
+uint32_t simbus_spi_overhead_ns = 1000;
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+
+static std::chrono::steady_clock::time_point t0 =
+    std::chrono::steady_clock::now();
+
+unsigned long millis(void) {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - t0)
+      .count();
+}
+unsigned long micros(void) {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - t0)
+      .count();
+}
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+void delayMicroseconds(unsigned int us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+void yield(void) {}
+void pinMode(int, int) {}
+void digitalWrite(int, int) {}
+int digitalRead(int) { return 0; }
+long random(long max) { return max ? rand() % max : 0; }
+long random(long mn, long mx) { return mn + random(mx - mn); }
+void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+size_t Print::print(int v, int base) { return print((long)v, base); }
+size_t Print::print(unsigned int v, int base) {
+  return print((unsigned long)v, base);
+}
+size_t Print::print(long v, int base) {
+  char buf[34];
+  if (base == 16)
+    snprintf(buf, sizeof(buf), "%lx", v);
+  else
+    snprintf(buf, sizeof(buf), "%ld", v);
+  return print(buf);
+}
+size_t Print::print(unsigned long v, int base) {
+  char buf[34];
+  if (base == 16)
+    snprintf(buf, sizeof(buf), "%lx", v);
+  else
+    snprintf(buf, sizeof(buf), "%lu", v);
+  return print(buf);
+}
+size_t Print::print(double v, int digits) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", digits, v);
+  return print(buf);
+}
+
+// ---------------- Adafruit_GFX ----------------
+
+static inline void sim_swap(int16_t &a, int16_t &b) {
+  int16_t t = a;
+  a = b;
+  b = t;
+}
+
+// deterministic stand-in for the classic 5x7 font
+static uint8_t sim_font_col(unsigned char c, uint8_t i) {
+  return (uint8_t)((c * 31u + i * 97u + 13u) & 0x7F);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color) {
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    sim_swap(x0, y0);
+    sim_swap(x1, y1);
+  }
+  if (x0 > x1) {
+    sim_swap(x0, x1);
+    sim_swap(y0, y1);
+  }
+  int16_t dx = x1 - x0, dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      drawPixel(y0, x0, color);
+    else
+      drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  drawLine(x, y, x, y + h - 1, color);
+}
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  drawLine(x, y, x + w - 1, y, color);
+}
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  for (int16_t i = x; i < x + w; i++)
+    drawFastVLine(i, y, h, color);
+}
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                              int16_t w, int16_t h, uint16_t color) {
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7)
+        b <<= 1;
+      else
+        b = bitmap[j * byteWidth + i / 8];
+      if (b & 0x80)
+        drawPixel(x + i, y, color);
+    }
+  }
+}
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size_x,
+                            uint8_t size_y) {
+  for (int8_t i = 0; i < 6; i++) {
+    uint8_t line = (i < 5) ? sim_font_col(c, i) : 0;
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if (line & 1) {
+        if (size_x == 1 && size_y == 1)
+          drawPixel(x + i, y + j, color);
+        else
+          fillRect(x + i * size_x, y + j * size_y, size_x, size_y, color);
+      } else if (bg != color) {
+        if (size_x == 1 && size_y == 1)
+          drawPixel(x + i, y + j, bg);
+        else
+          fillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+      }
+    }
+  }
+}
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  switch (rotation) {
+  case 0:
+  case 2:
+    _width = WIDTH;
+    _height = HEIGHT;
+    break;
+  case 1:
+  case 3:
+    _width = HEIGHT;
+    _height = WIDTH;
+    break;
+  }
+}
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (!gfxFont) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+      if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+               textsize_y);
+      cursor_x += textsize_x * 6;
+    }
+  }
+  return 1;
+}
+
+// ---------------- Adafruit_GrayOLED ----------------
+
+Adafruit_GrayOLED::Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h,
+                                     TwoWire *twi, int8_t rst_pin,
+                                     uint32_t preclk, uint32_t postclk)
+    : Adafruit_GFX(w, h), rstPin(rst_pin), _bpp(bpp), _theWire(twi) {
+  i2c_preclk = preclk;
+  i2c_postclk = postclk;
+}
+Adafruit_GrayOLED::Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h,
+                                     int8_t mosi_pin, int8_t sclk_pin,
+                                     int8_t dc_pin, int8_t rst_pin,
+                                     int8_t cs_pin)
+    : Adafruit_GFX(w, h), mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin),
+      csPin(cs_pin), rstPin(rst_pin), _bpp(bpp) {
+  spi_dev = new Adafruit_SPIDevice(cs_pin, sclk_pin, -1, mosi_pin, 1000000);
+}
+Adafruit_GrayOLED::Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h,
+                                     SPIClass *spi, int8_t dc_pin,
+                                     int8_t rst_pin, int8_t cs_pin,
+                                     uint32_t bitrate)
+    : Adafruit_GFX(w, h), dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin),
+      _bpp(bpp) {
+  spi_dev = new Adafruit_SPIDevice(cs_pin, bitrate, SPI_BITORDER_MSBFIRST,
+                                   SPI_MODE0, spi);
+}
+Adafruit_GrayOLED::~Adafruit_GrayOLED() {
+  if (buffer) {
+    free(buffer);
+    buffer = nullptr;
+  }
+  delete i2c_dev;
+  delete spi_dev;
+}
+
+bool Adafruit_GrayOLED::_init(uint8_t addr, bool reset) {
+  (void)reset;
+  if ((!buffer) &&
+      !(buffer = (uint8_t *)malloc(_bpp * WIDTH * ((HEIGHT + 7) / 8))))
+    return false;
+  clearDisplay();
+  if (!spi_dev) {
+    i2caddr = addr;
+    if (!i2c_dev)
+      i2c_dev = new Adafruit_I2CDevice(addr, _theWire);
+    i2c_dev->begin();
+  }
+  return true;
+}
+
+bool Adafruit_GrayOLED::oled_command(uint8_t c) {
+  if (i2c_dev) {
+    uint8_t buf[2] = {0x00, c};
+    return i2c_dev->write(buf, 2);
+  } else {
+    digitalWrite(dcPin, LOW);
+    return spi_dev->write(&c, 1);
+  }
+}
+bool Adafruit_GrayOLED::oled_commandList(const uint8_t *c, uint8_t n) {
+  if (i2c_dev) {
+    uint8_t dc_byte = 0x00;
+    return i2c_dev->write(c, n, true, &dc_byte, 1);
+  } else {
+    digitalWrite(dcPin, LOW);
+    return spi_dev->write(c, n);
+  }
+}
+
+void Adafruit_GrayOLED::clearDisplay(void) {
+  memset(buffer, 0, _bpp * WIDTH * ((HEIGHT + 7) / 8));
+  window_x1 = 0;
+  window_y1 = 0;
+  window_x2 = WIDTH - 1;
+  window_y2 = HEIGHT - 1;
+}
+void Adafruit_GrayOLED::invertDisplay(bool i) {
+  oled_command(i ? GRAYOLED_INVERTDISPLAY : GRAYOLED_NORMALDISPLAY);
+}
+void Adafruit_GrayOLED::setContrast(uint8_t level) {
+  uint8_t cmd[] = {GRAYOLED_SETCONTRAST, level};
+  oled_commandList(cmd, 2);
+}
+uint8_t *Adafruit_GrayOLED::getBuffer(void) { return buffer; }
+
+void Adafruit_GrayOLED::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
+    switch (getRotation()) {
+    case 1:
+      sim_swap(x, y);
+      x = WIDTH - x - 1;
+      break;
+    case 2:
+      x = WIDTH - x - 1;
+      y = HEIGHT - y - 1;
+      break;
+    case 3:
+      sim_swap(x, y);
+      y = HEIGHT - y - 1;
+      break;
+    }
+    window_x1 = min(window_x1, x);
+    window_y1 = min(window_y1, y);
+    window_x2 = max(window_x2, x);
+    window_y2 = max(window_y2, y);
+    if (_bpp == 1) {
+      switch (color) {
+      case MONOOLED_WHITE:
+        buffer[x + (y / 8) * WIDTH] |= (1 << (y & 7));
+        break;
+      case MONOOLED_BLACK:
+        buffer[x + (y / 8) * WIDTH] &= ~(1 << (y & 7));
+        break;
+      case MONOOLED_INVERSE:
+        buffer[x + (y / 8) * WIDTH] ^= (1 << (y & 7));
+        break;
+      }
+    }
+  }
+}
+bool Adafruit_GrayOLED::getPixel(int16_t x, int16_t y) {
+  if ((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
+    switch (getRotation()) {
+    case 1:
+      sim_swap(x, y);
+      x = WIDTH - x - 1;
+      break;
+    case 2:
+      x = WIDTH - x - 1;
+      y = HEIGHT - y - 1;
+      break;
+    case 3:
+      sim_swap(x, y);
+      y = HEIGHT - y - 1;
+      break;
+    }
+    return (buffer[x + (y / 8) * WIDTH] & (1 << (y & 7)));
+  }
+  return false;
+}
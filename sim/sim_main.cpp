@@ -0,0 +1,210 @@
+/*!
+ * @file sim_main.cpp
+ *
+ * Entry point for the host-side simulation: a byte-count regression
+ * suite over the library's transfer paths (run with no arguments), a
+ * terminal/PBM renderer for eyeballing the framebuffer, and a bench
+ * loop that animates a scene through displayIfDirty() so the drawing
+ * and diffing code can sit under perf or valgrind.
+ */
+#include <cstdio>
+#include <cstring>
+
+#include "Adafruit_SH110X.h"
+#include "sim_bus.h"
+
+// ---------------- rendering ----------------
+
+/*! Dump the (rotation-adjusted) framebuffer to the terminal. */
+static void renderTerminal(Adafruit_GrayOLED &d) {
+  int16_t w = d.width(), h = d.height();
+  putchar('+');
+  for (int16_t x = 0; x < w; x++)
+    putchar('-');
+  puts("+");
+  for (int16_t y = 0; y < h; y++) {
+    putchar('|');
+    for (int16_t x = 0; x < w; x++)
+      putchar(d.getPixel(x, y) ? '#' : ' ');
+    puts("|");
+  }
+  putchar('+');
+  for (int16_t x = 0; x < w; x++)
+    putchar('-');
+  puts("+");
+}
+
+/*! Write the framebuffer as a plain (P1) PBM image. */
+static bool writePBM(Adafruit_GrayOLED &d, const char *path) {
+  FILE *f = fopen(path, "w");
+  if (!f)
+    return false;
+  int16_t w = d.width(), h = d.height();
+  fprintf(f, "P1\n%d %d\n", w, h);
+  for (int16_t y = 0; y < h; y++) {
+    for (int16_t x = 0; x < w; x++)
+      fprintf(f, "%d ", d.getPixel(x, y) ? 1 : 0);
+    fputc('\n', f);
+  }
+  fclose(f);
+  return true;
+}
+
+// ---------------- regression suite ----------------
+
+static int fails = 0;
+#define CHECK(cond, msg)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: %s\n", msg);                                               \
+      fails++;                                                                 \
+    }                                                                          \
+  } while (0)
+
+/*! Expose protected bus handles for the assertions below. */
+class SimSH1106G : public Adafruit_SH1106G {
+public:
+  SimSH1106G() : Adafruit_SH1106G(128, 64, &Wire) {}
+  Adafruit_I2CDevice *dev() { return i2c_dev; }
+};
+
+static void demoScene(Adafruit_SH110X &d) {
+  d.clearDisplay();
+  d.drawRect(0, 0, d.width(), d.height(), SH110X_WHITE);
+  d.fillRect(8, 8, 40, 20, SH110X_WHITE);
+  d.drawLine(0, d.height() - 1, d.width() - 1, 0, SH110X_WHITE);
+  d.setCursor(8, 40);
+  d.setTextColor(SH110X_WHITE);
+  d.print("SH110X sim");
+}
+
+static void runRegression(void) {
+  // --- I2C paths, SH1106G 128x64 ---
+  SimSH1106G d;
+  CHECK(d.begin(0x3C, true), "begin");
+  d.dev()->setMaxBufferSize(256); // whole page fits one coalesced write
+
+  // full frame: 8 pages x (7-byte interleaved preamble + 128 data)
+  demoScene(d);
+  simbus_i2c.reset();
+  d.display();
+  CHECK(simbus_i2c.bytes == 8u * (7 + 128), "full-frame byte count");
+  double full_ms = simbus_i2c.modeled_ms();
+
+  // clean screen: zero bus traffic
+  simbus_i2c.reset();
+  CHECK(!d.displayIfDirty(), "clean displayIfDirty returns false");
+  CHECK(simbus_i2c.bytes == 0, "clean frame is free");
+
+  // single pixel: one coalesced write, preamble + 1 data byte
+  d.drawPixel(64, 32, SH110X_WHITE);
+  simbus_i2c.reset();
+  d.display();
+  CHECK(simbus_i2c.bytes == 8, "single-pixel byte count");
+  CHECK(simbus_i2c.transactions == 1, "single-pixel transaction count");
+
+  // dirty spans: damage on two pages costs two short writes, not a
+  // full-frame sweep
+  d.drawPixel(10, 5, SH110X_WHITE);  // page 0
+  d.drawPixel(100, 60, SH110X_WHITE); // page 7
+  simbus_i2c.reset();
+  d.display();
+  CHECK(simbus_i2c.transactions == 2, "disjoint damage transaction count");
+  CHECK(simbus_i2c.bytes == 2 * 8, "disjoint damage byte count");
+
+  // shadow delta: an unchanged frame re-pushed costs nothing, a small
+  // change costs only its span
+  CHECK(d.setDoubleBuffer(true), "setDoubleBuffer");
+  d.display(); // primes the shadow
+  simbus_i2c.reset();
+  d.fillRect(8, 8, 40, 20, SH110X_WHITE); // redraws identical content
+  d.display();
+  CHECK(simbus_i2c.bytes == 0, "unchanged frame under delta is free");
+  d.fillRect(20, 10, 8, 8, SH110X_BLACK);
+  simbus_i2c.reset();
+  d.display();
+  CHECK(simbus_i2c.bytes > 0 && simbus_i2c.bytes < 8u * (7 + 128) / 4,
+        "small delta costs a fraction of a frame");
+  d.setDoubleBuffer(false);
+
+  // pluggable transport: a frame queues all pages and goes out in one
+  // flush -- per page, a 4-byte command write plus a 129-byte data write
+  SH110X_I2CTransport transport(d.dev());
+  d.setTransport(&transport);
+  demoScene(d);
+  simbus_i2c.reset();
+  d.display();
+  CHECK(simbus_i2c.bytes == 8u * (4 + 129), "transport full-frame byte count");
+  CHECK(simbus_i2c.transactions == 16, "transport write count");
+  d.setTransport(NULL);
+
+  // --- SPI paths, SH1107 64x128 ---
+  Adafruit_SH1107 s(64, 128, &SPI, 5, 6, 7, 8000000UL);
+  CHECK(s.begin(0, true), "spi begin");
+  demoScene(s);
+  simbus_spi.reset();
+  s.display();
+  // one CS assertion per frame; 16 pages x (3 command + 64 data) bytes
+  CHECK(simbus_spi.transactions == 1, "spi frame is one transaction");
+  CHECK(simbus_spi.bytes == 16u * (3 + 64), "spi full-frame byte count");
+  double spi_ms = simbus_spi.modeled_ms();
+
+  printf("%s\n", fails ? "REGRESSION FAILED" : "regression PASS");
+  printf("modeled full frame: %.2f ms (I2C 128x64 @%u Hz), "
+         "%.2f ms (SPI 64x128 @8 MHz)\n",
+         full_ms, d.dev()->speed, spi_ms);
+}
+
+// ---------------- bench loop ----------------
+
+/*! Animate a bouncing box + text through displayIfDirty() for perf/
+    valgrind runs; frame count from --bench N. */
+static void runBench(long frames) {
+  SimSH1106G d;
+  if (!d.begin(0x3C, true))
+    return;
+  d.setDoubleBuffer(true);
+  int16_t x = 0, y = 0, dx = 3, dy = 2;
+  for (long i = 0; i < frames; i++) {
+    d.clearDisplay();
+    d.fillRect(x, y, 24, 16, SH110X_WHITE);
+    d.setCursor(2, 54);
+    d.setTextColor(SH110X_WHITE);
+    d.print("frame");
+    x += dx;
+    y += dy;
+    if (x <= 0 || x + 24 >= d.width())
+      dx = -dx;
+    if (y <= 0 || y + 16 >= d.height())
+      dy = -dy;
+    d.display();
+  }
+  printf("bench: %ld frames, %u transactions, %llu bytes, "
+         "%.1f ms modeled bus time\n",
+         frames, simbus_i2c.transactions,
+         (unsigned long long)simbus_i2c.bytes, simbus_i2c.modeled_ms());
+}
+
+int main(int argc, char **argv) {
+  if (argc >= 2 && !strcmp(argv[1], "--bench")) {
+    runBench(argc >= 3 ? atol(argv[2]) : 2000);
+    return 0;
+  }
+  if (argc >= 2 && (!strcmp(argv[1], "--render") || !strcmp(argv[1], "--pbm"))) {
+    SimSH1106G d;
+    if (!d.begin(0x3C, true))
+      return 1;
+    demoScene(d);
+    if (!strcmp(argv[1], "--pbm")) {
+      const char *path = argc >= 3 ? argv[2] : "sh110x_frame.pbm";
+      if (!writePBM(d, path))
+        return 1;
+      printf("wrote %s\n", path);
+    } else {
+      renderTerminal(d);
+    }
+    return 0;
+  }
+  runRegression();
+  return fails ? 1 : 0;
+}